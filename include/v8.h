@@ -1299,16 +1299,40 @@ class V8_EXPORT ScriptCompiler {
     CachedData& operator=(const CachedData&) = delete;
   };
 
+  /**
+   * A task which performs the parts of consuming a code cache entry that do
+   * not require access to the isolate's heap, most notably validating the
+   * payload checksum. Returned by ScriptCompiler::StartConsumingCodeCache.
+   * The embedder should run the task on a background thread, at most once,
+   * and may then attach it to a Source so that the main-thread consume step
+   * can skip the work the task has already done. The task does not take
+   * ownership of the cached data; the embedder must keep the task, the
+   * cached data and its buffer alive until compilation has completed.
+   */
+  class V8_EXPORT CodeCacheConsumptionTask {
+   public:
+    virtual ~CodeCacheConsumptionTask() {}
+
+    /**
+     * Performs the background part of consuming the code cache entry. Can be
+     * called on any thread.
+     */
+    virtual void Run() = 0;
+  };
+
   /**
    * Source code which can be then compiled to a UnboundScript or Script.
    */
   class Source {
    public:
-    // Source takes ownership of CachedData.
+    // Source takes ownership of CachedData, but not of the
+    // CodeCacheConsumptionTask.
     V8_INLINE Source(Local<String> source_string, const ScriptOrigin& origin,
-           CachedData* cached_data = NULL);
+                     CachedData* cached_data = NULL,
+                     CodeCacheConsumptionTask* consumption_task = NULL);
     V8_INLINE Source(Local<String> source_string,
-                     CachedData* cached_data = NULL);
+                     CachedData* cached_data = NULL,
+                     CodeCacheConsumptionTask* consumption_task = NULL);
     V8_INLINE ~Source();
 
     // Ownership of the CachedData or its buffers is *not* transferred to the
@@ -1339,6 +1363,10 @@ class V8_EXPORT ScriptCompiler {
     // set), or hold newly generated cache data (kProduce*Cache flags) are
     // set when calling a compile method.
     CachedData* cached_data;
+
+    // Background validation of the cached data, if the embedder started one
+    // via ScriptCompiler::StartConsumingCodeCache. Not owned.
+    CodeCacheConsumptionTask* consumption_task;
   };
 
   /**
@@ -1425,6 +1453,18 @@ class V8_EXPORT ScriptCompiler {
     virtual void Run() = 0;
   };
 
+  /**
+   * Compilation options. With kProduceCodeCache and kProduceFullCodeCache,
+   * the source may carry cached data from a previous cache production; it is
+   * then used as the base cache, and if the script's source and compilation
+   * state are unchanged, the produced cache is a cheap copy of the base cache
+   * instead of being re-serialized.
+   *
+   * A parser cache produced with kProduceParserCache also contains the
+   * preparse data of the script's lazy top-level functions, so consuming it
+   * in a fresh process avoids re-preparsing their inner functions when the
+   * lazy functions are first compiled.
+   */
   enum CompileOptions {
     kNoCompileOptions = 0,
     kProduceParserCache,
@@ -1508,6 +1548,17 @@ class V8_EXPORT ScriptCompiler {
       Isolate* isolate, StreamedSource* source,
       CompileOptions options = kNoCompileOptions);
 
+  /**
+   * Returns a task which performs the heap-independent part of consuming a
+   * code cache entry, so that only a short fix-up step remains for the main
+   * thread. The user is responsible for running the task on a background
+   * thread, passing it to the Source used for compilation with
+   * kConsumeCodeCache, and deleting it after compilation has completed. The
+   * cached data and its buffer must stay alive until then.
+   */
+  static CodeCacheConsumptionTask* StartConsumingCodeCache(
+      Isolate* isolate, const CachedData* cached_data);
+
   /**
    * Compiles a streamed script (bound to current context).
    *
@@ -3143,6 +3194,17 @@ class V8_EXPORT Object : public Value {
                                                        uint32_t index,
                                                        Local<Value> value);
 
+  // Defines several data properties in one call, as if by calling
+  // CreateDataProperty for each of the |count| key/value pairs in order.
+  // Entering the API only once makes this cheaper than per-property calls
+  // when an object is built up from native code.
+  //
+  // Returns true if all properties were defined. Stops at the first pair
+  // that cannot be defined or throws.
+  V8_WARN_UNUSED_RESULT Maybe<bool> CreateDataProperties(
+      Local<Context> context, Local<Name>* keys, Local<Value>* values,
+      size_t count);
+
   // Implements DefineOwnProperty.
   //
   // In general, CreateDataProperty will be faster, however, does not allow
@@ -6185,6 +6247,27 @@ class V8_EXPORT ResourceConstraints {
     max_zone_pool_size_ = bytes;
   }
 
+  /**
+   * Placement policies for heap pages on NUMA systems.
+   */
+  enum class PagePlacementPolicy {
+    /** Leave page placement to the operating system. */
+    kDefault,
+    /**
+     * Pre-fault new heap pages on the allocating thread, so that operating
+     * systems with a first-touch NUMA policy back them with memory local to
+     * that thread's node.
+     */
+    kFirstTouch
+  };
+
+  PagePlacementPolicy page_placement_policy() const {
+    return page_placement_policy_;
+  }
+  void set_page_placement_policy(PagePlacementPolicy policy) {
+    page_placement_policy_ = policy;
+  }
+
  private:
   // max_semi_space_size_ is in KB
   size_t max_semi_space_size_in_kb_;
@@ -6195,6 +6278,7 @@ class V8_EXPORT ResourceConstraints {
   uint32_t* stack_limit_;
   size_t code_range_size_;
   size_t max_zone_pool_size_;
+  PagePlacementPolicy page_placement_policy_;
 };
 
 
@@ -6583,6 +6667,17 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+class V8_EXPORT HeapContextStatistics {
+ public:
+  HeapContextStatistics();
+  size_t size_of_objects_at_last_gc() { return size_of_objects_at_last_gc_; }
+
+ private:
+  size_t size_of_objects_at_last_gc_;
+
+  friend class Isolate;
+};
+
 class RetainedObjectInfo;
 
 
@@ -7259,6 +7354,20 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Get approximate statistics about the heap memory attributable to the
+   * given context. The counters are recomputed at full-GC epochs when the
+   * --per_context_heap_stats flag is enabled; reading them is cheap.
+   *
+   * \param context_statistics The HeapContextStatistics object to fill in
+   *   statistics for the context.
+   * \param context The context to get statistics for.
+   * \returns true on success, false if tracking is disabled or no
+   *   measurement has been recorded for the context yet.
+   */
+  bool GetHeapStatisticsForContext(HeapContextStatistics* context_statistics,
+                                   Local<Context> context);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -9675,7 +9784,8 @@ Local<Integer> ScriptOrigin::ScriptID() const { return script_id_; }
 Local<Value> ScriptOrigin::SourceMapUrl() const { return source_map_url_; }
 
 ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
-                               CachedData* data)
+                               CachedData* data,
+                               CodeCacheConsumptionTask* task)
     : source_string(string),
       resource_name(origin.ResourceName()),
       resource_line_offset(origin.ResourceLineOffset()),
@@ -9683,11 +9793,12 @@ ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
       resource_options(origin.Options()),
       source_map_url(origin.SourceMapUrl()),
       host_defined_options(origin.HostDefinedOptions()),
-      cached_data(data) {}
+      cached_data(data),
+      consumption_task(task) {}
 
-ScriptCompiler::Source::Source(Local<String> string,
-                               CachedData* data)
-    : source_string(string), cached_data(data) {}
+ScriptCompiler::Source::Source(Local<String> string, CachedData* data,
+                               CodeCacheConsumptionTask* task)
+    : source_string(string), cached_data(data), consumption_task(task) {}
 
 
 ScriptCompiler::Source::~Source() {
@@ -902,7 +902,8 @@ ResourceConstraints::ResourceConstraints()
       max_old_space_size_(0),
       stack_limit_(nullptr),
       code_range_size_(0),
-      max_zone_pool_size_(0) {}
+      max_zone_pool_size_(0),
+      page_placement_policy_(PagePlacementPolicy::kDefault) {}
 
 void ResourceConstraints::ConfigureDefaults(uint64_t physical_memory,
                                             uint64_t virtual_memory_limit) {
@@ -933,6 +934,10 @@ void SetResourceConstraints(i::Isolate* isolate,
   }
   isolate->allocator()->ConfigureSegmentPool(max_pool_size);
 
+  isolate->heap()->set_first_touch_page_placement(
+      constraints.page_placement_policy() ==
+      ResourceConstraints::PagePlacementPolicy::kFirstTouch);
+
   if (constraints.stack_limit() != nullptr) {
     uintptr_t limit = reinterpret_cast<uintptr_t>(constraints.stack_limit());
     isolate->stack_guard()->SetStackLimit(limit);
@@ -2295,6 +2300,20 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
     // ScriptData takes care of pointer-aligning the data.
     script_data = new i::ScriptData(source->cached_data->data,
                                     source->cached_data->length);
+    if (options == kConsumeCodeCache && source->consumption_task != nullptr) {
+      auto* task = static_cast<i::BackgroundCodeCacheCheckTask*>(
+          source->consumption_task);
+      DCHECK_EQ(task->data(), source->cached_data->data);
+      if (task->checks_passed()) script_data->set_background_checked();
+    }
+  } else if ((options == kProduceCodeCache ||
+              options == kProduceFullCodeCache) &&
+             source->cached_data != nullptr) {
+    // An existing code cache serves as the base cache: if the script's source
+    // and compilation state are unchanged, producing copies the base cache
+    // instead of re-serializing the whole script.
+    script_data = new i::ScriptData(source->cached_data->data,
+                                    source->cached_data->length);
   }
 
   i::Handle<i::String> str = Utils::OpenHandle(*(source->source_string));
@@ -2338,7 +2357,8 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
 
   if (produce_cache && script_data != nullptr) {
     // script_data now contains the data that was generated. source will
-    // take the ownership.
+    // take the ownership. Delete any base cache it was still holding.
+    delete source->cached_data;
     source->cached_data = new CachedData(
         script_data->data(), script_data->length(), CachedData::BufferOwned);
     script_data->ReleaseDataOwnership();
@@ -2575,6 +2595,13 @@ ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
                                       i::FLAG_stack_size, isolate);
 }
 
+ScriptCompiler::CodeCacheConsumptionTask*
+ScriptCompiler::StartConsumingCodeCache(Isolate* v8_isolate,
+                                        const CachedData* cached_data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  return new i::BackgroundCodeCacheCheckTask(isolate, cached_data);
+}
+
 
 MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
                                            StreamedSource* v8_source,
@@ -4413,6 +4440,30 @@ Maybe<bool> v8::Object::CreateDataProperty(v8::Local<v8::Context> context,
   return result;
 }
 
+Maybe<bool> v8::Object::CreateDataProperties(v8::Local<v8::Context> context,
+                                             v8::Local<Name>* keys,
+                                             v8::Local<Value>* values,
+                                             size_t count) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, Object, CreateDataProperties, Nothing<bool>(),
+           i::HandleScope);
+  i::Handle<i::JSReceiver> self = Utils::OpenHandle(this);
+
+  for (size_t i = 0; i < count; ++i) {
+    i::Handle<i::Name> key_obj = Utils::OpenHandle(*keys[i]);
+    i::Handle<i::Object> value_obj = Utils::OpenHandle(*values[i]);
+
+    i::LookupIterator it = i::LookupIterator::PropertyOrElement(
+        isolate, self, key_obj, self, i::LookupIterator::OWN);
+    Maybe<bool> result =
+        i::JSReceiver::CreateDataProperty(&it, value_obj, i::kDontThrow);
+    has_pending_exception = result.IsNothing();
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+    if (!result.FromJust()) return Just(false);
+  }
+  return Just(true);
+}
+
 struct v8::PropertyDescriptor::PrivateData {
   PrivateData() : desc() {}
   i::PropertyDescriptor desc;
@@ -6502,6 +6553,9 @@ HeapObjectStatistics::HeapObjectStatistics()
 HeapCodeStatistics::HeapCodeStatistics()
     : code_and_metadata_size_(0), bytecode_and_metadata_size_(0) {}
 
+HeapContextStatistics::HeapContextStatistics()
+    : size_of_objects_at_last_gc_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -8904,6 +8958,22 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+bool Isolate::GetHeapStatisticsForContext(
+    HeapContextStatistics* context_statistics, Local<Context> context) {
+  if (!context_statistics) return false;
+  if (V8_LIKELY(!i::FLAG_per_context_heap_stats)) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::Handle<i::Context> env = Utils::OpenHandle(*context);
+  size_t size_of_objects = 0;
+  if (!isolate->heap()->SizeOfObjectsForContextAtLastGC(env->native_context(),
+                                                        &size_of_objects)) {
+    return false;
+  }
+  context_statistics->size_of_objects_at_last_gc_ = size_of_objects;
+  return true;
+}
+
 void Isolate::GetStackSample(const RegisterState& state, void** frames,
                              size_t frames_limit, SampleInfo* sample_info) {
   RegisterState regs = state;
@@ -404,7 +404,7 @@ class HandleScopeImplementer {
   explicit HandleScopeImplementer(Isolate* isolate)
       : isolate_(isolate),
         microtask_context_(nullptr),
-        spare_(nullptr),
+        spare_count_(0),
         call_depth_(0),
         microtasks_depth_(0),
         microtasks_suppressions_(0),
@@ -417,7 +417,7 @@ class HandleScopeImplementer {
   }
 
   ~HandleScopeImplementer() {
-    DeleteArray(spare_);
+    DeleteSpareBlocks();
   }
 
   // Threading support for handle data.
@@ -488,8 +488,11 @@ class HandleScopeImplementer {
 
   void ReturnBlock(Object** block) {
     DCHECK_NOT_NULL(block);
-    if (spare_ != nullptr) DeleteArray(spare_);
-    spare_ = block;
+    if (spare_count_ < kSpareBlockCount) {
+      spare_blocks_[spare_count_++] = block;
+    } else {
+      DeleteArray(block);
+    }
   }
 
  private:
@@ -499,7 +502,7 @@ class HandleScopeImplementer {
     saved_contexts_.detach();
     microtask_context_ = nullptr;
     entered_context_count_during_microtasks_ = 0;
-    spare_ = nullptr;
+    spare_count_ = 0;
     last_handle_before_deferred_block_ = nullptr;
     call_depth_ = 0;
   }
@@ -513,13 +516,16 @@ class HandleScopeImplementer {
     blocks_.free();
     entered_contexts_.free();
     saved_contexts_.free();
-    if (spare_ != nullptr) {
-      DeleteArray(spare_);
-      spare_ = nullptr;
-    }
+    DeleteSpareBlocks();
     DCHECK_EQ(call_depth_, 0);
   }
 
+  void DeleteSpareBlocks() {
+    while (spare_count_ > 0) {
+      DeleteArray(spare_blocks_[--spare_count_]);
+    }
+  }
+
   void BeginDeferredScope();
   DeferredHandles* Detach(Object** prev_limit);
 
@@ -530,7 +536,12 @@ class HandleScopeImplementer {
   // Used as a stack to keep track of saved contexts.
   DetachableVector<Context*> saved_contexts_;
   Context* microtask_context_;
-  Object** spare_;
+  // Pool of handle blocks kept around for reuse. API-heavy code repeatedly
+  // opens scopes that grow beyond the current block, and retaining a few
+  // spare blocks keeps that churn away from the allocator.
+  static const int kSpareBlockCount = 8;
+  Object** spare_blocks_[kSpareBlockCount];
+  int spare_count_;
   int call_depth_;
   int microtasks_depth_;
   int microtasks_suppressions_;
@@ -620,11 +631,8 @@ Handle<Context> HandleScopeImplementer::MicrotaskContext() {
 
 // If there's a spare block, use it for growing the current scope.
 internal::Object** HandleScopeImplementer::GetSpareOrNewBlock() {
-  internal::Object** block =
-      (spare_ != nullptr) ? spare_
-                          : NewArray<internal::Object*>(kHandleBlockSize);
-  spare_ = nullptr;
-  return block;
+  if (spare_count_ > 0) return spare_blocks_[--spare_count_];
+  return NewArray<internal::Object*>(kHandleBlockSize);
 }
 
 
@@ -645,10 +653,11 @@ void HandleScopeImplementer::DeleteExtensions(internal::Object** prev_limit) {
 #ifdef ENABLE_HANDLE_ZAPPING
     internal::HandleScope::ZapRange(block_start, block_limit);
 #endif
-    if (spare_ != nullptr) {
-      DeleteArray(spare_);
+    if (spare_count_ < kSpareBlockCount) {
+      spare_blocks_[spare_count_++] = block_start;
+    } else {
+      DeleteArray(block_start);
     }
-    spare_ = block_start;
   }
   DCHECK((blocks_.empty() && prev_limit == nullptr) ||
          (!blocks_.empty() && prev_limit != nullptr));
@@ -170,7 +170,6 @@ void AstConsString::Internalize(Isolate* isolate) {
 
 AstStringConstants::AstStringConstants(Isolate* isolate, uint32_t hash_seed)
     : zone_(isolate->allocator(), ZONE_NAME),
-      string_table_(AstRawString::Compare),
       hash_seed_(hash_seed) {
   DCHECK(ThreadId::Current().Equals(isolate->thread_id()));
 #define F(name, str)                                                       \
@@ -184,7 +183,7 @@ AstStringConstants::AstStringConstants(Isolate* isolate, uint32_t hash_seed)
     /* The Handle returned by the factory is located on the roots */       \
     /* array, not on the temporary HandleScope, so this is safe.  */       \
     name##_string_->set_string(isolate->factory()->name##_string());       \
-    base::HashMap::Entry* entry =                                          \
+    AstRawStringMap::Entry* entry =                                        \
         string_table_.InsertNew(name##_string_, name##_string_->Hash());   \
     DCHECK_NULL(entry->value);                                             \
     entry->value = reinterpret_cast<void*>(1);                             \
@@ -274,7 +273,8 @@ AstRawString* AstValueFactory::GetString(uint32_t hash_field, bool is_one_byte,
   // against the AstRawStrings which are in the string_table_. We should not
   // return this AstRawString.
   AstRawString key(is_one_byte, literal_bytes, hash_field);
-  base::HashMap::Entry* entry = string_table_.LookupOrInsert(&key, key.Hash());
+  AstRawStringMap::Entry* entry =
+      string_table_.LookupOrInsert(&key, key.Hash());
   if (entry->value == nullptr) {
     // Copy literal contents for later comparison.
     int length = literal_bytes.length();
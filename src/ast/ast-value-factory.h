@@ -78,6 +78,7 @@ class AstRawString final : public ZoneObject {
   friend class AstRawStringInternalizationKey;
   friend class AstStringConstants;
   friend class AstValueFactory;
+  friend struct AstRawStringMatcher;
 
   // Members accessed only by the AstValueFactory & related classes:
   static bool Compare(void* a, void* b);
@@ -123,6 +124,21 @@ class AstRawString final : public ZoneObject {
 #endif
 };
 
+// Matches AstRawStrings by comparing hashes first and contents second. The
+// matcher is a functor, so the hash map's probe loop inlines the whole
+// comparison instead of calling through a function pointer per collision as
+// base::CustomMatcherHashMap does.
+struct AstRawStringMatcher {
+  bool operator()(uint32_t hash1, uint32_t hash2, void* const& key1,
+                  void* const& key2) const {
+    return hash1 == hash2 && AstRawString::Compare(key1, key2);
+  }
+};
+
+typedef base::TemplateHashMapImpl<void*, void*, AstRawStringMatcher,
+                                  base::DefaultAllocationPolicy>
+    AstRawStringMap;
+
 class AstConsString final : public ZoneObject {
  public:
   AstConsString* AddString(Zone* zone, const AstRawString* s) {
@@ -243,13 +259,11 @@ class AstStringConstants final {
 #undef F
 
   uint32_t hash_seed() const { return hash_seed_; }
-  const base::CustomMatcherHashMap* string_table() const {
-    return &string_table_;
-  }
+  const AstRawStringMap* string_table() const { return &string_table_; }
 
  private:
   Zone zone_;
-  base::CustomMatcherHashMap string_table_;
+  AstRawStringMap string_table_;
   uint32_t hash_seed_;
 
 #define F(name, str) AstRawString* name##_string_;
@@ -331,7 +345,7 @@ class AstValueFactory {
                           Vector<const byte> literal_bytes);
 
   // All strings are copied here, one after another (no zeroes inbetween).
-  base::CustomMatcherHashMap string_table_;
+  AstRawStringMap string_table_;
 
   // We need to keep track of strings_ in order since cons strings require their
   // members to be internalized first.
@@ -4276,6 +4276,18 @@ void Genesis::InitializeGlobal_harmony_sharedarraybuffer() {
   }
 }
 
+void Genesis::InitializeGlobal_harmony_atomics_bulk_operations() {
+  if (!FLAG_harmony_atomics_bulk_operations) return;
+
+  Handle<JSGlobalObject> global(native_context()->global_object());
+  Isolate* isolate = global->GetIsolate();
+
+  SimpleInstallFunction(isolate->atomics_object(), "copy",
+                        Builtins::kAtomicsCopy, 5, true);
+  SimpleInstallFunction(isolate->atomics_object(), "fill",
+                        Builtins::kAtomicsFill, 4, true);
+}
+
 void Genesis::InitializeGlobal_harmony_array_prototype_values() {
   if (!FLAG_harmony_array_prototype_values) return;
   Handle<JSFunction> array_constructor(native_context()->array_function());
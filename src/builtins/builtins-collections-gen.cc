@@ -271,6 +271,24 @@ TF_BUILTIN(MapConstructor, CollectionsBuiltinsAssembler) {
 
   GotoIf(Word32Or(IsUndefined(iterable), IsNull(iterable)), &exit);
 
+  // If the iterable is an array, its length bounds the number of entries
+  // added below; presize the backing table for large arrays so that the
+  // construction loop does not rehash repeatedly. This happens before any
+  // user-observable step, so it is invisible apart from timing.
+  {
+    Label done_presizing(this);
+    GotoIf(TaggedIsSmi(iterable), &done_presizing);
+    GotoIfNot(IsJSArray(iterable), &done_presizing);
+    Node* const length = LoadObjectField(iterable, JSArray::kLengthOffset);
+    GotoIfNot(TaggedIsSmi(length), &done_presizing);
+    GotoIfNot(
+        SmiGreaterThan(length, SmiConstant(OrderedHashMap::kMinCapacity)),
+        &done_presizing);
+    CallRuntime(Runtime::kMapReserve, context, var_result.value(), length);
+    Goto(&done_presizing);
+    BIND(&done_presizing);
+  }
+
   Label if_notcallable(this);
   // TODO (gsathya): Add fast path for unmodified maps. id:332 gh:333
   Node* const adder = GetProperty(context, var_result.value(),
@@ -391,6 +409,24 @@ TF_BUILTIN(SetConstructor, CollectionsBuiltinsAssembler) {
 
   GotoIf(Word32Or(IsUndefined(iterable), IsNull(iterable)), &exit);
 
+  // If the iterable is an array, its length bounds the number of entries
+  // added below; presize the backing table for large arrays so that the
+  // construction loop does not rehash repeatedly. This happens before any
+  // user-observable step, so it is invisible apart from timing.
+  {
+    Label done_presizing(this);
+    GotoIf(TaggedIsSmi(iterable), &done_presizing);
+    GotoIfNot(IsJSArray(iterable), &done_presizing);
+    Node* const length = LoadObjectField(iterable, JSArray::kLengthOffset);
+    GotoIfNot(TaggedIsSmi(length), &done_presizing);
+    GotoIfNot(
+        SmiGreaterThan(length, SmiConstant(OrderedHashSet::kMinCapacity)),
+        &done_presizing);
+    CallRuntime(Runtime::kSetReserve, context, var_result.value(), length);
+    Goto(&done_presizing);
+    BIND(&done_presizing);
+  }
+
   Label if_notcallable(this);
   // TODO (gsathya): Add fast path for unmodified maps. id:277 gh:278
   Node* const adder = GetProperty(context, var_result.value(),
@@ -180,6 +180,34 @@ void ToDateString(double time_val, Vector<char> str, DateCache* date_cache,
   UNREACHABLE();
 }
 
+// Fixed-width decimal writers for the ISO-8601 layout produced by
+// Date.prototype.toISOString. The format is fully fixed, so spelling the
+// digits out directly avoids the general SNPrintF machinery on that path.
+char* WriteTwoDigits(char* p, int n) {
+  DCHECK(0 <= n && n < 100);
+  p[0] = '0' + (n / 10);
+  p[1] = '0' + (n % 10);
+  return p + 2;
+}
+
+char* WriteThreeDigits(char* p, int n) {
+  DCHECK(0 <= n && n < 1000);
+  p[0] = '0' + (n / 100);
+  return WriteTwoDigits(p + 1, n % 100);
+}
+
+char* WriteFourDigits(char* p, int n) {
+  DCHECK(0 <= n && n < 10000);
+  p = WriteTwoDigits(p, n / 100);
+  return WriteTwoDigits(p, n % 100);
+}
+
+char* WriteSixDigits(char* p, int n) {
+  DCHECK(0 <= n && n < 1000000);
+  p = WriteTwoDigits(p, n / 10000);
+  return WriteFourDigits(p, n % 10000);
+}
+
 Object* SetLocalDateValue(Handle<JSDate> date, double time_val) {
   if (time_val >= -DateCache::kMaxTimeBeforeUTCInMs &&
       time_val <= DateCache::kMaxTimeBeforeUTCInMs) {
@@ -773,17 +801,33 @@ BUILTIN(DatePrototypeToISOString) {
   int year, month, day, weekday, hour, min, sec, ms;
   isolate->date_cache()->BreakDownTime(time_ms, &year, &month, &day, &weekday,
                                        &hour, &min, &sec, &ms);
-  char buffer[128];
+  // "[+-]yyyyyy-mm-ddThh:mm:ss.sssZ", with a four digit year iff it is in
+  // the range [0, 9999].
+  char buffer[32];
+  char* p = buffer;
   if (year >= 0 && year <= 9999) {
-    SNPrintF(ArrayVector(buffer), "%04d-%02d-%02dT%02d:%02d:%02d.%03dZ", year,
-             month + 1, day, hour, min, sec, ms);
+    p = WriteFourDigits(p, year);
   } else if (year < 0) {
-    SNPrintF(ArrayVector(buffer), "-%06d-%02d-%02dT%02d:%02d:%02d.%03dZ", -year,
-             month + 1, day, hour, min, sec, ms);
+    *p++ = '-';
+    p = WriteSixDigits(p, -year);
   } else {
-    SNPrintF(ArrayVector(buffer), "+%06d-%02d-%02dT%02d:%02d:%02d.%03dZ", year,
-             month + 1, day, hour, min, sec, ms);
-  }
+    *p++ = '+';
+    p = WriteSixDigits(p, year);
+  }
+  *p++ = '-';
+  p = WriteTwoDigits(p, month + 1);
+  *p++ = '-';
+  p = WriteTwoDigits(p, day);
+  *p++ = 'T';
+  p = WriteTwoDigits(p, hour);
+  *p++ = ':';
+  p = WriteTwoDigits(p, min);
+  *p++ = ':';
+  p = WriteTwoDigits(p, sec);
+  *p++ = '.';
+  p = WriteThreeDigits(p, ms);
+  *p++ = 'Z';
+  *p = '\0';
   return *isolate->factory()->NewStringFromAsciiChecked(buffer);
 }
 
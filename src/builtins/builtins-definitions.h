@@ -904,6 +904,9 @@ namespace internal {
   CPP(AtomicsIsLockFree)                                                       \
   CPP(AtomicsWait)                                                             \
   CPP(AtomicsWake)                                                             \
+  /* Non-standard, behind --harmony-atomics-bulk-operations */                 \
+  CPP(AtomicsCopy)                                                             \
+  CPP(AtomicsFill)                                                             \
                                                                                \
   /* String */                                                                 \
   TFJ(StringConstructor, SharedFunctionInfo::kDontAdaptArgumentsSentinel)      \
@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <cstring>
+
+#include "src/base/atomicops.h"
 #include "src/base/macros.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
@@ -162,5 +166,176 @@ BUILTIN(AtomicsWait) {
                               timeout_number);
 }
 
+namespace {
+
+// Converts an index or count argument with Atomics error reporting, without
+// any bounds check.
+MUST_USE_RESULT Maybe<size_t> ToAtomicSize(Isolate* isolate,
+                                           Handle<Object> object) {
+  Handle<Object> number;
+  ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+      isolate, number,
+      Object::ToIndex(isolate, object,
+                      MessageTemplate::kInvalidAtomicAccessIndex),
+      Nothing<size_t>());
+  size_t result;
+  if (!TryNumberToSize(*number, &result)) {
+    isolate->Throw(*isolate->factory()->NewRangeError(
+        MessageTemplate::kInvalidAtomicAccessIndex));
+    return Nothing<size_t>();
+  }
+  return Just(result);
+}
+
+// Checks that [index, index + count) lies within the typed array. Unlike
+// ValidateAtomicAccess, index == length is allowed when count is zero.
+bool AtomicRangeIsValid(Handle<JSTypedArray> sta, size_t index, size_t count) {
+  size_t length = sta->length_value();
+  return index <= length && count <= length - index;
+}
+
+size_t SharedIntegerElementSize(Handle<JSTypedArray> sta) {
+  switch (sta->type()) {
+    case kExternalInt8Array:
+    case kExternalUint8Array:
+      return 1;
+    case kExternalInt16Array:
+    case kExternalUint16Array:
+      return 2;
+    case kExternalInt32Array:
+    case kExternalUint32Array:
+      return 4;
+    default:
+      UNREACHABLE();
+  }
+}
+
+uint8_t* SharedElementsBase(Handle<JSTypedArray> sta) {
+  return static_cast<uint8_t*>(sta->GetBuffer()->backing_store()) +
+         NumberToSize(sta->byte_offset());
+}
+
+}  // namespace
+
+// Non-standard extension, behind --harmony-atomics-bulk-operations.
+// Atomics.copy( dstTypedArray, dstIndex, srcTypedArray, srcIndex, count )
+//
+// Copies count elements in one memmove instead of element-at-a-time atomic
+// accesses. The copy is not element-wise atomic: individual elements may be
+// observed torn while the copy is in progress. The fences on either side
+// give the transfer as a whole the same publication semantics as a SeqCst
+// store, which is what ring-buffer style message passing needs.
+BUILTIN(AtomicsCopy) {
+  HandleScope scope(isolate);
+  Handle<Object> dst = args.atOrUndefined(isolate, 1);
+  Handle<Object> dst_index = args.atOrUndefined(isolate, 2);
+  Handle<Object> src = args.atOrUndefined(isolate, 3);
+  Handle<Object> src_index = args.atOrUndefined(isolate, 4);
+  Handle<Object> count = args.atOrUndefined(isolate, 5);
+
+  Handle<JSTypedArray> dst_sta;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, dst_sta, ValidateSharedIntegerTypedArray(isolate, dst));
+  Handle<JSTypedArray> src_sta;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, src_sta, ValidateSharedIntegerTypedArray(isolate, src));
+
+  if (dst_sta->type() != src_sta->type()) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kNotSameSharedTypedArrayType));
+  }
+
+  Maybe<size_t> maybe_dst_index = ToAtomicSize(isolate, dst_index);
+  if (maybe_dst_index.IsNothing()) return isolate->heap()->exception();
+  size_t dst_i = maybe_dst_index.FromJust();
+
+  Maybe<size_t> maybe_src_index = ToAtomicSize(isolate, src_index);
+  if (maybe_src_index.IsNothing()) return isolate->heap()->exception();
+  size_t src_i = maybe_src_index.FromJust();
+
+  Maybe<size_t> maybe_count = ToAtomicSize(isolate, count);
+  if (maybe_count.IsNothing()) return isolate->heap()->exception();
+  size_t c = maybe_count.FromJust();
+
+  if (!AtomicRangeIsValid(dst_sta, dst_i, c) ||
+      !AtomicRangeIsValid(src_sta, src_i, c)) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewRangeError(MessageTemplate::kInvalidAtomicAccessIndex));
+  }
+
+  size_t element_size = SharedIntegerElementSize(dst_sta);
+  uint8_t* dst_base = SharedElementsBase(dst_sta);
+  uint8_t* src_base = SharedElementsBase(src_sta);
+
+  base::SeqCst_MemoryFence();
+  // memmove, not memcpy: the ranges may overlap within one shared buffer.
+  std::memmove(dst_base + dst_i * element_size,
+               src_base + src_i * element_size, c * element_size);
+  base::SeqCst_MemoryFence();
+
+  return isolate->heap()->undefined_value();
+}
+
+// Non-standard extension, behind --harmony-atomics-bulk-operations.
+// Atomics.fill( typedArray, index, count, value )
+//
+// Stores value into count consecutive elements. Like Atomics.copy, the fill
+// is not element-wise atomic but is fenced on both sides.
+BUILTIN(AtomicsFill) {
+  HandleScope scope(isolate);
+  Handle<Object> array = args.atOrUndefined(isolate, 1);
+  Handle<Object> index = args.atOrUndefined(isolate, 2);
+  Handle<Object> count = args.atOrUndefined(isolate, 3);
+  Handle<Object> value = args.atOrUndefined(isolate, 4);
+
+  Handle<JSTypedArray> sta;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, sta, ValidateSharedIntegerTypedArray(isolate, array));
+
+  Maybe<size_t> maybe_index = ToAtomicSize(isolate, index);
+  if (maybe_index.IsNothing()) return isolate->heap()->exception();
+  size_t i = maybe_index.FromJust();
+
+  Maybe<size_t> maybe_count = ToAtomicSize(isolate, count);
+  if (maybe_count.IsNothing()) return isolate->heap()->exception();
+  size_t c = maybe_count.FromJust();
+
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, value,
+                                     Object::ToInteger(isolate, value));
+  uint32_t raw_value = NumberToUint32(*value);
+
+  if (!AtomicRangeIsValid(sta, i, c)) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewRangeError(MessageTemplate::kInvalidAtomicAccessIndex));
+  }
+
+  uint8_t* base = SharedElementsBase(sta);
+
+  base::SeqCst_MemoryFence();
+  switch (sta->type()) {
+    case kExternalInt8Array:
+    case kExternalUint8Array:
+      std::memset(base + i, static_cast<uint8_t>(raw_value), c);
+      break;
+    case kExternalInt16Array:
+    case kExternalUint16Array: {
+      uint16_t* p = reinterpret_cast<uint16_t*>(base) + i;
+      std::fill(p, p + c, static_cast<uint16_t>(raw_value));
+      break;
+    }
+    case kExternalInt32Array:
+    case kExternalUint32Array: {
+      uint32_t* p = reinterpret_cast<uint32_t*>(base) + i;
+      std::fill(p, p + c, raw_value);
+      break;
+    }
+    default:
+      UNREACHABLE();
+  }
+  base::SeqCst_MemoryFence();
+
+  return isolate->heap()->undefined_value();
+}
+
 }  // namespace internal
 }  // namespace v8
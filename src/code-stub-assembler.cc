@@ -1943,6 +1943,15 @@ TNode<Smi> CodeStubAssembler::BuildAppendJSArray(ElementsKind kind,
   PossiblyGrowElementsCapacity(mode, kind, array, var_length.value(),
                                &var_elements, growth, &pre_bailout);
 
+  if (IsSmiOrObjectElementsKind(kind)) {
+    // If the capacity already sufficed, the backing store may still be
+    // copy-on-write and shared with another array that can observe its
+    // spare slots; copy it before storing into it.
+    var_elements.Bind(CopyElementsOnWrite(array, var_elements.value(), kind,
+                                          var_length.value(), mode,
+                                          &pre_bailout));
+  }
+
   // Push each argument onto the end of the array now that there is enough
   // capacity.
   CodeStubAssembler::VariableList push_vars({&var_length}, zone());
@@ -2010,6 +2019,13 @@ void CodeStubAssembler::BuildAppendJSArray(ElementsKind kind, Node* array,
   PossiblyGrowElementsCapacity(mode, kind, array, var_length.value(),
                                &var_elements, growth, bailout);
 
+  if (IsSmiOrObjectElementsKind(kind)) {
+    // See the argument-pushing variant above: a copy-on-write backing
+    // store with enough spare capacity must be copied before the store.
+    var_elements.Bind(CopyElementsOnWrite(array, var_elements.value(), kind,
+                                          var_length.value(), mode, bailout));
+  }
+
   // Push each argument onto the end of the array now that there is enough
   // capacity.
   TryStoreArrayElement(kind, mode, bailout, var_elements.value(),
@@ -7610,12 +7626,17 @@ void CodeStubAssembler::EmitElementStore(Node* object, Node* key, Node* value,
                                          Label* bailout) {
   CSA_ASSERT(this, Word32BinaryNot(IsJSProxy(object)));
   Node* elements = LoadElements(object);
-  if (IsSmiOrObjectElementsKind(elements_kind) &&
-      store_mode != STORE_NO_TRANSITION_HANDLE_COW) {
-    // Bailout in case of COW elements.
-    GotoIf(WordNotEqual(LoadMap(elements),
-                        LoadRoot(Heap::kFixedArrayMapRootIndex)),
-           bailout);
+  if (IsSmiOrObjectElementsKind(elements_kind)) {
+    // Regardless of the store mode the handler was installed for, a store
+    // must never write into a copy-on-write backing store: arrays can come
+    // to share one (literals, full-length slices) after the handler was
+    // trained. STORE_NO_TRANSITION_HANDLE_COW copies the store below;
+    // every other mode bails out on anything but a plain FixedArray.
+    if (store_mode != STORE_NO_TRANSITION_HANDLE_COW) {
+      GotoIf(WordNotEqual(LoadMap(elements),
+                          LoadRoot(Heap::kFixedArrayMapRootIndex)),
+             bailout);
+    }
   }
   // TODO (ishell): introduce TryToIntPtrOrSmi() and use OptimalParameterMode(). id:411 gh:412
   ParameterMode parameter_mode = INTPTR_PARAMETERS;
@@ -247,6 +247,21 @@ MaybeHandle<FixedArray> CompilationCacheRegExp::Lookup(
   }
 }
 
+void CompilationCacheRegExp::Age() {
+  // Rotating the generations on every mark-compact evicts any pattern that
+  // has not been looked up since the last-but-one full GC. Workloads that
+  // cycle through a modest set of patterns more slowly than full GCs occur
+  // would recompile the whole set after every collection. Instead, keep all
+  // generations alive while the young generation is below its entry cap and
+  // only rotate once it has filled up; this pins a bounded working set
+  // across GCs while still letting the cache shed dead patterns over time.
+  Object* first_table = RawTable(kFirstGeneration);
+  if (first_table->IsUndefined(isolate())) return;
+  CompilationCacheTable* table = CompilationCacheTable::cast(first_table);
+  if (table->NumberOfElements() < kMaxYoungEntries) return;
+  CompilationSubCache::Age();
+}
+
 void CompilationCacheRegExp::Put(Handle<String> source,
                                  JSRegExp::Flags flags,
                                  Handle<FixedArray> data) {
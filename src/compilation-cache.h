@@ -29,7 +29,7 @@ class CompilationSubCache {
     tables_ = NewArray<Object*>(generations);
   }
 
-  ~CompilationSubCache() { DeleteArray(tables_); }
+  virtual ~CompilationSubCache() { DeleteArray(tables_); }
 
   // Index for the first generation in the cache.
   static const int kFirstGeneration = 0;
@@ -48,7 +48,7 @@ class CompilationSubCache {
 
   // Age the sub-cache by evicting the oldest generation and creating a new
   // young generation.
-  void Age();
+  virtual void Age();
 
   // GC support.
   void Iterate(RootVisitor* v);
@@ -65,6 +65,13 @@ class CompilationSubCache {
  protected:
   Isolate* isolate() { return isolate_; }
 
+  // Get the compilation cache table for a specific generation without
+  // allocating a new table if none exists yet.
+  Object* RawTable(int generation) {
+    DCHECK_LT(generation, generations_);
+    return tables_[generation];
+  }
+
  private:
   Isolate* isolate_;
   int generations_;  // Number of generations.
@@ -139,7 +146,16 @@ class CompilationCacheRegExp: public CompilationSubCache {
   void Put(Handle<String> source,
            JSRegExp::Flags flags,
            Handle<FixedArray> data);
+
+  // Age the sub-cache only once the young generation has filled up, so that
+  // a bounded working set of patterns survives mark-compact collections.
+  void Age() override;
+
  private:
+  // Maximum number of entries in the young generation before aging evicts
+  // the oldest generation.
+  static const int kMaxYoungEntries = 128;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationCacheRegExp);
 };
 
@@ -885,6 +885,11 @@ bool Compiler::Compile(Handle<SharedFunctionInfo> shared_info,
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileCode");
   AggregatedHistogramTimerScope timer(isolate->counters()->compile_lazy());
 
+  // Remember this compilation for profile-guided compile-ahead; code caches
+  // produced for the script later will list this function (see
+  // CodeSerializer).
+  if (FLAG_compile_ahead) isolate->RecordLazyCompilation(*shared_info);
+
   // Check if the compiler dispatcher has shared_info enqueued for compile.
   CompilerDispatcher* dispatcher = isolate->compiler_dispatcher();
   if (dispatcher->IsEnqueued(shared_info)) {
@@ -1400,7 +1405,11 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     cached_data = nullptr;
   } else if (compile_options == ScriptCompiler::kProduceParserCache ||
              ShouldProduceCodeCache(compile_options)) {
-    DCHECK(cached_data && !*cached_data);
+    DCHECK_NOT_NULL(cached_data);
+    // When producing a code cache, *cached_data may hold a previously
+    // produced cache to be used as the base for incremental production.
+    DCHECK_IMPLIES(compile_options == ScriptCompiler::kProduceParserCache,
+                   !*cached_data);
     DCHECK_NULL(extension);
     DCHECK(!isolate->debug()->is_loaded());
   } else {
@@ -1537,7 +1546,10 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
                                            &RuntimeCallStats::CompileSerialize);
         TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                      "V8.CompileSerialize");
-        *cached_data = CodeSerializer::Serialize(isolate, result, source);
+        ScriptData* base_cache = *cached_data;
+        *cached_data =
+            CodeSerializer::Serialize(isolate, result, source, base_cache);
+        delete base_cache;
         if (FLAG_profile_deserialization) {
           PrintF("[Compiling and serializing took %0.3f ms]\n",
                  timer.Elapsed().InMillisecondsF());
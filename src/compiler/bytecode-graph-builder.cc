@@ -878,11 +878,36 @@ void BytecodeGraphBuilder::VisitLdaConstant() {
   environment()->BindAccumulator(node);
 }
 
+void BytecodeGraphBuilder::VisitLdaZeroStar() {
+  Node* node = jsgraph()->ZeroConstant();
+  environment()->BindAccumulator(node);
+  environment()->BindRegister(bytecode_iterator().GetRegisterOperand(0), node);
+}
+
+void BytecodeGraphBuilder::VisitLdaSmiStar() {
+  Node* node = jsgraph()->Constant(bytecode_iterator().GetImmediateOperand(0));
+  environment()->BindAccumulator(node);
+  environment()->BindRegister(bytecode_iterator().GetRegisterOperand(1), node);
+}
+
+void BytecodeGraphBuilder::VisitLdaConstantStar() {
+  Node* node =
+      jsgraph()->Constant(bytecode_iterator().GetConstantForIndexOperand(0));
+  environment()->BindAccumulator(node);
+  environment()->BindRegister(bytecode_iterator().GetRegisterOperand(1), node);
+}
+
 void BytecodeGraphBuilder::VisitLdaUndefined() {
   Node* node = jsgraph()->UndefinedConstant();
   environment()->BindAccumulator(node);
 }
 
+void BytecodeGraphBuilder::VisitLdaUndefinedStar() {
+  Node* node = jsgraph()->UndefinedConstant();
+  environment()->BindAccumulator(node);
+  environment()->BindRegister(bytecode_iterator().GetRegisterOperand(0), node);
+}
+
 void BytecodeGraphBuilder::VisitLdaNull() {
   Node* node = jsgraph()->NullConstant();
   environment()->BindAccumulator(node);
@@ -2038,6 +2063,33 @@ void BytecodeGraphBuilder::BuildBinaryOp(const Operator* op) {
   environment()->BindAccumulator(node, Environment::kAttachFrameState);
 }
 
+// Variant of BuildBinaryOp for the fused Ldar+binary-op bytecodes, which
+// take the right-hand side from a register instead of the accumulator.
+void BytecodeGraphBuilder::BuildBinaryOpWithRegisterOperands(
+    const Operator* op) {
+  PrepareEagerCheckpoint();
+  Node* right =
+      environment()->LookupRegister(bytecode_iterator().GetRegisterOperand(0));
+  Node* left =
+      environment()->LookupRegister(bytecode_iterator().GetRegisterOperand(1));
+
+  FeedbackSlot slot =
+      feedback_vector()->ToSlot(bytecode_iterator().GetIndexOperand(2));
+  JSTypeHintLowering::LoweringResult lowering =
+      TryBuildSimplifiedBinaryOp(op, left, right, slot);
+  if (lowering.IsExit()) return;
+
+  Node* node = nullptr;
+  if (lowering.IsSideEffectFree()) {
+    node = lowering.value();
+  } else {
+    DCHECK(!lowering.Changed());
+    node = NewNode(op, left, right);
+  }
+
+  environment()->BindAccumulator(node, Environment::kAttachFrameState);
+}
+
 // Helper function to create binary operation hint from the recorded type
 // feedback.
 BinaryOperationHint BytecodeGraphBuilder::GetBinaryOperationHint(
@@ -2140,10 +2192,19 @@ void BytecodeGraphBuilder::VisitAdd() {
       javascript()->Add(GetBinaryOperationHint(kBinaryOperationHintIndex)));
 }
 
+void BytecodeGraphBuilder::VisitLdarAdd() {
+  BuildBinaryOpWithRegisterOperands(
+      javascript()->Add(GetBinaryOperationHint(2)));
+}
+
 void BytecodeGraphBuilder::VisitSub() {
   BuildBinaryOp(javascript()->Subtract());
 }
 
+void BytecodeGraphBuilder::VisitLdarSub() {
+  BuildBinaryOpWithRegisterOperands(javascript()->Subtract());
+}
+
 void BytecodeGraphBuilder::VisitMul() {
   BuildBinaryOp(javascript()->Multiply());
 }
@@ -172,6 +172,7 @@ class BytecodeGraphBuilder {
     BuildCall(receiver_mode, args.begin(), args.size(), slot_id);
   }
   void BuildBinaryOp(const Operator* op);
+  void BuildBinaryOpWithRegisterOperands(const Operator* op);
   void BuildBinaryOpWithImmediate(const Operator* op);
   void BuildCompareOp(const Operator* op);
   void BuildTestingOp(const Operator* op);
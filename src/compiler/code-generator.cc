@@ -170,12 +170,23 @@ void CodeGenerator::AssembleCode() {
       code()->InstructionBlockCount());
 
   // Assemble all non-deferred blocks, followed by deferred ones.
+  bool cold_code_aligned = false;
   for (int deferred = 0; deferred < 2; ++deferred) {
     for (const InstructionBlock* block : code()->instruction_blocks()) {
       if (block->IsDeferred() == (deferred == 0)) {
         continue;
       }
 
+      // The deferred blocks form a trailing cold region; align its start on
+      // a cache line boundary so that cold code does not share instruction
+      // cache lines with the hot path.
+      if (deferred == 1 && !cold_code_aligned) {
+        cold_code_aligned = true;
+        if (FLAG_turbo_align_cold_code && !tasm()->jump_optimization_info()) {
+          static const int kInstructionCacheLineSize = 64;
+          tasm()->Align(kInstructionCacheLineSize);
+        }
+      }
       // Align loop headers on 16-byte boundaries.
       if (block->IsLoopHeader() && !tasm()->jump_optimization_info()) {
         tasm()->Align(16);
@@ -906,8 +917,12 @@ int CodeGenerator::BuildTranslation(Instruction* instr, int pc_offset,
 
   int deoptimization_id = static_cast<int>(deoptimization_states_.size());
 
+  // Deoptimization points that describe the same frame layout can share one
+  // translation.
+  int translation_index = translations_.Deduplicate(translation.index());
+
   deoptimization_states_.push_back(new (zone()) DeoptimizationState(
-      descriptor->bailout_id(), translation.index(), pc_offset, entry.kind(),
+      descriptor->bailout_id(), translation_index, pc_offset, entry.kind(),
       entry.reason()));
 
   return deoptimization_id;
@@ -120,7 +120,7 @@ Reduction GraphReducer::Reduce(Node* const node) {
 
 
 void GraphReducer::ReduceTop() {
-  NodeState& entry = stack_.top();
+  NodeState& entry = stack_.back();
   Node* node = entry.node;
   DCHECK_EQ(State::kOnStack, state_.Get(node));
 
@@ -262,16 +262,16 @@ void GraphReducer::ReplaceWithValue(Node* node, Node* value, Node* effect,
 
 
 void GraphReducer::Pop() {
-  Node* node = stack_.top().node;
+  Node* node = stack_.back().node;
   state_.Set(node, State::kVisited);
-  stack_.pop();
+  stack_.pop_back();
 }
 
 
 void GraphReducer::Push(Node* const node) {
   DCHECK_NE(State::kOnStack, state_.Get(node));
   state_.Set(node, State::kOnStack);
-  stack_.push({node, 0});
+  stack_.push_back({node, 0});
 }
 
 
@@ -178,7 +178,9 @@ class V8_EXPORT_PRIVATE GraphReducer
   NodeMarker<State> state_;
   ZoneVector<Reducer*> reducers_;
   ZoneQueue<Node*> revisit_;
-  ZoneStack<NodeState> stack_;
+  // The traversal stack is usually shallow; inline storage keeps small
+  // reductions from allocating zone memory at all.
+  SmallZoneVector<NodeState, 16> stack_;
 
   DISALLOW_COPY_AND_ASSIGN(GraphReducer);
 };
@@ -362,8 +362,9 @@ void MemoryOptimizer::VisitStoreElement(Node* node,
   ElementAccess const& access = ElementAccessOf(node->op());
   Node* object = node->InputAt(0);
   Node* index = node->InputAt(1);
+  Node* value = node->InputAt(2);
   WriteBarrierKind write_barrier_kind =
-      ComputeWriteBarrierKind(object, state, access.write_barrier_kind);
+      ComputeWriteBarrierKind(object, value, state, access.write_barrier_kind);
   node->ReplaceInput(1, ComputeIndex(access, index));
   NodeProperties::ChangeOp(
       node, machine()->Store(StoreRepresentation(
@@ -376,8 +377,9 @@ void MemoryOptimizer::VisitStoreField(Node* node,
   DCHECK_EQ(IrOpcode::kStoreField, node->opcode());
   FieldAccess const& access = FieldAccessOf(node->op());
   Node* object = node->InputAt(0);
+  Node* value = node->InputAt(1);
   WriteBarrierKind write_barrier_kind =
-      ComputeWriteBarrierKind(object, state, access.write_barrier_kind);
+      ComputeWriteBarrierKind(object, value, state, access.write_barrier_kind);
   Node* offset = jsgraph()->IntPtrConstant(access.offset - access.tag());
   node->InsertInput(graph()->zone(), 1, offset);
   NodeProperties::ChangeOp(
@@ -419,10 +421,23 @@ Node* MemoryOptimizer::ComputeIndex(ElementAccess const& access, Node* key) {
 }
 
 WriteBarrierKind MemoryOptimizer::ComputeWriteBarrierKind(
-    Node* object, AllocationState const* state,
+    Node* object, Node* value, AllocationState const* state,
     WriteBarrierKind write_barrier_kind) {
+  WriteBarrierKind const requested_kind = write_barrier_kind;
   if (state->IsNewSpaceAllocation() && state->group()->Contains(object)) {
     write_barrier_kind = kNoWriteBarrier;
+  } else if (state->group() != nullptr && state->group()->Contains(object) &&
+             state->group()->Contains(value)) {
+    // Both {object} and {value} stem from the same allocation group, so
+    // there cannot be a GC between their allocation and this store. Either
+    // both are still white, or (with black allocation) both were allocated
+    // black, hence neither the generational nor the incremental marking
+    // barrier can have anything to record here.
+    write_barrier_kind = kNoWriteBarrier;
+  }
+  if (write_barrier_kind == kNoWriteBarrier &&
+      requested_kind != kNoWriteBarrier) {
+    isolate()->counters()->write_barriers_elided()->Increment();
   }
   return write_barrier_kind;
 }
@@ -276,6 +276,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kCheckedStoreFloat32:
     case kCheckedStoreFloat64:
     case kSSEFloat64Mul:
+    case kAVXFloat64Mul:
       return 5;
     case kX64Imul:
     case kX64Imul32:
@@ -293,8 +294,19 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Min:
     case kSSEFloat64Abs:
     case kSSEFloat64Neg:
+    case kAVXFloat32Cmp:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat32Abs:
+    case kAVXFloat32Neg:
+    case kAVXFloat64Cmp:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+    case kAVXFloat64Abs:
+    case kAVXFloat64Neg:
       return 3;
     case kSSEFloat32Mul:
+    case kAVXFloat32Mul:
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
     case kSSEFloat32Round:
@@ -316,6 +328,8 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Div:
     case kSSEFloat32Sqrt:
     case kSSEFloat64Sqrt:
+    case kAVXFloat32Div:
+    case kAVXFloat64Div:
       return 13;
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
@@ -326,6 +340,14 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
       return 50;
     case kArchTruncateDoubleToI:
       return 6;
+    case kX64Movl:
+    case kX64Movq:
+    case kX64Movsd:
+    case kX64Movss:
+    case kX64Movdqu:
+      // Register moves are cheap, but loads have to wait for memory.
+      return instr->HasOutput() && instr->addressing_mode() != kMode_None ? 5
+                                                                          : 1;
     default:
       return 1;
   }
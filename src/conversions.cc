@@ -995,6 +995,14 @@ const char* DoubleToCString(double v, Vector<char> buffer) {
 }
 
 
+// Lookup table of all two-digit decimal numbers, "00" through "99".
+static const char kTwoDigitChars[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
 const char* IntToCString(int n, Vector<char> buffer) {
   bool negative = false;
   if (n < 0) {
@@ -1003,13 +1011,23 @@ const char* IntToCString(int n, Vector<char> buffer) {
     negative = true;
     n = -n;
   }
-  // Build the string backwards from the least significant digit.
+  // Build the string backwards from the least significant digit, taking
+  // two digits from the table per division to halve the number of divides.
   int i = buffer.length();
   buffer[--i] = '\0';
-  do {
-    buffer[--i] = '0' + (n % 10);
-    n /= 10;
-  } while (n);
+  while (n >= 100) {
+    int pair = (n % 100) << 1;
+    n /= 100;
+    buffer[--i] = kTwoDigitChars[pair + 1];
+    buffer[--i] = kTwoDigitChars[pair];
+  }
+  if (n >= 10) {
+    int pair = n << 1;
+    buffer[--i] = kTwoDigitChars[pair + 1];
+    buffer[--i] = kTwoDigitChars[pair];
+  } else {
+    buffer[--i] = '0' + n;
+  }
   if (negative) buffer[--i] = '-';
   return buffer.start() + i;
 }
@@ -245,6 +245,10 @@ Counters::Counters(Isolate* isolate)
   {&Counters::size_of_FIXED_ARRAY_##name##_,  \
     "c:" "V8.SizeOf_FIXED_ARRAY-" #name},
       FIXED_ARRAY_SUB_INSTANCE_TYPE_LIST(SC)
+#undef SC
+#define SC(Name, message) \
+  {&Counters::deopt_reason_##Name##_, "c:" "V8.DeoptReason_" #Name},
+      DEOPTIMIZE_REASON_LIST(SC)
 #undef SC
   };
   // clang-format on
@@ -282,6 +286,19 @@ void Counters::ResetCounterFunction(CounterLookupCallback f) {
   size_of_FIXED_ARRAY_##name##_.Reset();
   FIXED_ARRAY_SUB_INSTANCE_TYPE_LIST(SC)
 #undef SC
+
+#define SC(Name, message) deopt_reason_##Name##_.Reset();
+  DEOPTIMIZE_REASON_LIST(SC)
+#undef SC
+}
+
+StatsCounter* Counters::deopt_reason(DeoptimizeReason reason) {
+  static StatsCounter Counters::*const kDeoptReasonCounters[] = {
+#define SC(Name, message) &Counters::deopt_reason_##Name##_,
+      DEOPTIMIZE_REASON_LIST(SC)
+#undef SC
+  };
+  return &(this->*kDeoptReasonCounters[static_cast<uint8_t>(reason)]);
 }
 
 void Counters::ResetCreateHistogramFunction(CreateHistogramCallback f) {
@@ -10,6 +10,7 @@
 #include "src/base/atomic-utils.h"
 #include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/time.h"
+#include "src/deoptimize-reason.h"
 #include "src/globals.h"
 #include "src/heap-symbols.h"
 #include "src/isolate.h"
@@ -1244,6 +1245,8 @@ class RuntimeCallTimerScope {
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
+  SC(descriptor_lookup_cache_hits, V8.DescriptorLookupCacheHits)               \
+  SC(descriptor_lookup_cache_misses, V8.DescriptorLookupCacheMisses)           \
   SC(fast_new_closure_total, V8.FastNewClosureTotal)                           \
   SC(string_add_runtime, V8.StringAddRuntime)                                  \
   SC(string_add_native, V8.StringAddNative)                                    \
@@ -1254,6 +1257,8 @@ class RuntimeCallTimerScope {
   SC(regexp_entry_native, V8.RegExpEntryNative)                                \
   SC(number_to_string_native, V8.NumberToStringNative)                         \
   SC(number_to_string_runtime, V8.NumberToStringRuntime)                       \
+  SC(number_string_cache_hits, V8.NumberStringCacheHits)                       \
+  SC(number_string_cache_misses, V8.NumberStringCacheMisses)                   \
   SC(math_exp_runtime, V8.MathExpRuntime)                                      \
   SC(math_log_runtime, V8.MathLogRuntime)                                      \
   SC(math_pow_runtime, V8.MathPowRuntime)                                      \
@@ -1268,6 +1273,8 @@ class RuntimeCallTimerScope {
   /* Number of write barriers in generated code. */                            \
   SC(write_barriers_dynamic, V8.WriteBarriersDynamic)                          \
   SC(write_barriers_static, V8.WriteBarriersStatic)                            \
+  /* Number of write barriers elided based on allocation folding. */           \
+  SC(write_barriers_elided, V8.WriteBarriersElided)                            \
   SC(new_space_bytes_available, V8.MemoryNewSpaceBytesAvailable)               \
   SC(new_space_bytes_committed, V8.MemoryNewSpaceBytesCommitted)               \
   SC(new_space_bytes_used, V8.MemoryNewSpaceBytesUsed)                         \
@@ -1372,6 +1379,10 @@ class Counters : public std::enable_shared_from_this<Counters> {
   INSTANCE_TYPE_LIST(SC)
 #undef SC
 
+  // Aggregated deoptimization counts by reason, so that deopt loops show up
+  // in counter-based telemetry without tracing flags.
+  StatsCounter* deopt_reason(DeoptimizeReason reason);
+
 #define SC(name) \
   StatsCounter* count_of_CODE_TYPE_##name() \
     { return &count_of_CODE_TYPE_##name##_; } \
@@ -1510,6 +1521,10 @@ class Counters : public std::enable_shared_from_this<Counters> {
   FIXED_ARRAY_SUB_INSTANCE_TYPE_LIST(SC)
 #undef SC
 
+#define SC(Name, message) StatsCounter deopt_reason_##Name##_;
+  DEOPTIMIZE_REASON_LIST(SC)
+#undef SC
+
   RuntimeCallStats runtime_call_stats_;
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(Counters);
@@ -2031,6 +2031,161 @@ void Shell::WriteLcovData(v8::Isolate* isolate, const char* file) {
   }
 }
 
+namespace {
+
+// HDR-style latency histogram: values are bucketed into power-of-two ranges,
+// each split into 16 linear sub-buckets, bounding the relative error of
+// reported percentiles by 1/16th while using a small fixed footprint.
+class ReplayLatencyHistogram {
+ public:
+  void Record(int64_t micros) {
+    if (micros < 0) micros = 0;
+    if (count_ == 0 || micros < min_) min_ = micros;
+    if (micros > max_) max_ = micros;
+    total_ += micros;
+    count_++;
+    counts_[BucketIndex(micros)]++;
+  }
+
+  int64_t count() const { return count_; }
+  int64_t min() const { return min_; }
+  int64_t max() const { return max_; }
+  int64_t mean() const { return count_ == 0 ? 0 : total_ / count_; }
+
+  // Returns the lower bound of the bucket holding the {p}-th percentile.
+  int64_t Percentile(double p) const {
+    int64_t threshold = static_cast<int64_t>(p / 100.0 * count_);
+    int64_t seen = 0;
+    for (int i = 0; i < kBucketCount; i++) {
+      seen += counts_[i];
+      if (seen > threshold) return BucketLowerBound(i);
+    }
+    return max_;
+  }
+
+ private:
+  static const int kSubBucketBits = 4;
+  static const int kSubBuckets = 1 << kSubBucketBits;
+  static const int kBucketCount = (64 - kSubBucketBits) * kSubBuckets;
+
+  static int BucketIndex(int64_t value) {
+    if (value < kSubBuckets) return static_cast<int>(value);
+    int log = 0;
+    for (int64_t v = value; v > 1; v >>= 1) log++;
+    int sub = static_cast<int>(value >> (log - kSubBucketBits)) &
+              (kSubBuckets - 1);
+    return (log - kSubBucketBits + 1) * kSubBuckets + sub;
+  }
+
+  static int64_t BucketLowerBound(int index) {
+    if (index < kSubBuckets) return index;
+    int log = index / kSubBuckets + kSubBucketBits - 1;
+    int sub = index % kSubBuckets;
+    return static_cast<int64_t>(kSubBuckets + sub) << (log - kSubBucketBits);
+  }
+
+  int64_t counts_[kBucketCount] = {0};
+  int64_t count_ = 0;
+  int64_t total_ = 0;
+  int64_t min_ = 0;
+  int64_t max_ = 0;
+};
+
+}  // namespace
+
+// Replays a recorded workload. Each non-empty line of the replay file has the
+// form
+//   <inter-arrival-ms> <statement>
+// Lines are executed in order; before each statement we sleep for the
+// recorded inter-arrival time, and the wall-clock latency of every execution
+// is collected into a histogram that is printed once the replay finishes.
+// Lines starting with '#' are comments.
+void Shell::RunReplayFile(Isolate* isolate, const char* file_name) {
+  std::ifstream replay(file_name);
+  if (!replay.good()) {
+    printf("Error reading replay file '%s'\n", file_name);
+    Exit(1);
+  }
+
+  Local<Context> context = isolate->GetCurrentContext();
+  ReplayLatencyHistogram histogram;
+  int errors = 0;
+
+  std::string line;
+  int line_number = 0;
+  while (std::getline(replay, line)) {
+    line_number++;
+    size_t pos = line.find_first_not_of(" \t");
+    if (pos == std::string::npos || line[pos] == '#') continue;
+
+    char* statement = nullptr;
+    double delay_ms = strtod(line.c_str() + pos, &statement);
+    if (statement == line.c_str() + pos) {
+      printf("%s:%d: expected '<inter-arrival-ms> <statement>'\n", file_name,
+             line_number);
+      Exit(1);
+    }
+    if (delay_ms > 0) {
+      base::OS::Sleep(base::TimeDelta::FromMicroseconds(
+          static_cast<int64_t>(delay_ms * 1000)));
+    }
+
+    HandleScope handle_scope(isolate);
+    TryCatch try_catch(isolate);
+    Local<String> source =
+        String::NewFromUtf8(isolate, statement, NewStringType::kNormal)
+            .ToLocalChecked();
+    ScriptOrigin origin(
+        String::NewFromUtf8(isolate, file_name, NewStringType::kNormal)
+            .ToLocalChecked());
+
+    base::TimeTicks start = base::TimeTicks::HighResolutionNow();
+    Local<Script> script;
+    bool success = Script::Compile(context, source, &origin).ToLocal(&script) &&
+                   !script->Run(context).IsEmpty();
+    int64_t micros =
+        (base::TimeTicks::HighResolutionNow() - start).InMicroseconds();
+
+    if (success) {
+      histogram.Record(micros);
+    } else {
+      errors++;
+      ReportException(isolate, &try_catch);
+    }
+  }
+
+  printf("replay: %" PRId64 " requests, %d errors\n", histogram.count(),
+         errors);
+  if (histogram.count() > 0) {
+    printf("latency (us): min %" PRId64 " mean %" PRId64 " p50 %" PRId64
+           " p90 %" PRId64 " p99 %" PRId64 " p99.9 %" PRId64 " max %" PRId64
+           "\n",
+           histogram.min(), histogram.mean(), histogram.Percentile(50),
+           histogram.Percentile(90), histogram.Percentile(99),
+           histogram.Percentile(99.9), histogram.max());
+  }
+}
+
+// Prints heap statistics as a single JSON object, for consumption by latency
+// investigation tooling driving the replay mode.
+void Shell::WriteGCStatsJson(Isolate* isolate) {
+  HeapStatistics stats;
+  isolate->GetHeapStatistics(&stats);
+  printf("{\"total_heap_size\": %" PRIuPTR
+         ", \"total_heap_size_executable\": %" PRIuPTR
+         ", \"total_physical_size\": %" PRIuPTR
+         ", \"total_available_size\": %" PRIuPTR
+         ", \"used_heap_size\": %" PRIuPTR ", \"heap_size_limit\": %" PRIuPTR
+         ", \"malloced_memory\": %" PRIuPTR
+         ", \"peak_malloced_memory\": %" PRIuPTR
+         ", \"does_zap_garbage\": %s}\n",
+         stats.total_heap_size(), stats.total_heap_size_executable(),
+         stats.total_physical_size(), stats.total_available_size(),
+         stats.used_heap_size(), stats.heap_size_limit(),
+         stats.malloced_memory(), stats.peak_malloced_memory(),
+         stats.does_zap_garbage() ? "true" : "false");
+}
+
 void Shell::OnExit(v8::Isolate* isolate) {
   // Dump basic block profiling data.
   if (i::BasicBlockProfiler* profiler =
@@ -2792,6 +2947,12 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--lcov=", 7) == 0) {
       options.lcov_file = argv[i] + 7;
       argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--replay=", 9) == 0) {
+      options.replay_file = argv[i] + 9;
+      argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--expose-gc-stats") == 0) {
+      options.expose_gc_stats = true;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--disable-in-process-stack-traces") == 0) {
       options.disable_in_process_stack_traces = true;
       argv[i] = nullptr;
@@ -2860,6 +3021,10 @@ int Shell::RunMain(Isolate* isolate, int argc, char* argv[], bool last_run) {
       InspectorClient inspector_client(context, options.enable_inspector);
       PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
       options.isolate_sources[0].Execute(isolate);
+      // Replay runs in the same context, so the replayed statements can call
+      // functions defined by the scripts given on the command line.
+      if (options.replay_file) RunReplayFile(isolate, options.replay_file);
+      if (options.expose_gc_stats) WriteGCStatsJson(isolate);
     }
     if (!use_existing_context) {
       DisposeModuleEmbedderData(context);
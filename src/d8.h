@@ -304,6 +304,8 @@ class ShellOptions {
         trace_enabled(false),
         trace_config(nullptr),
         lcov_file(nullptr),
+        replay_file(nullptr),
+        expose_gc_stats(false),
         disable_in_process_stack_traces(false),
         read_from_tcp_port(-1) {}
 
@@ -336,6 +338,8 @@ class ShellOptions {
   bool trace_enabled;
   const char* trace_config;
   const char* lcov_file;
+  const char* replay_file;
+  bool expose_gc_stats;
   bool disable_in_process_stack_traces;
   int read_from_tcp_port;
   bool enable_os_system = false;
@@ -490,6 +494,10 @@ class Shell : public i::AllStatic {
   static void WriteIgnitionDispatchCountersFile(v8::Isolate* isolate);
   // Append LCOV coverage data to file.
   static void WriteLcovData(v8::Isolate* isolate, const char* file);
+  // Replay a recorded workload with latency histogram output.
+  static void RunReplayFile(Isolate* isolate, const char* file_name);
+  // Print heap statistics as a JSON object.
+  static void WriteGCStatsJson(Isolate* isolate);
   static Counter* GetCounter(const char* name, bool is_histogram);
   static Local<String> Stringify(Isolate* isolate, Local<Value> value);
   static void Initialize(Isolate* isolate);
@@ -373,8 +373,10 @@ bool BytecodeHasNoSideEffect(interpreter::Bytecode bytecode) {
     // Arithmetics.
     case Bytecode::kAdd:
     case Bytecode::kAddSmi:
+    case Bytecode::kLdarAdd:
     case Bytecode::kSub:
     case Bytecode::kSubSmi:
+    case Bytecode::kLdarSub:
     case Bytecode::kMul:
     case Bytecode::kMulSmi:
     case Bytecode::kDiv:
@@ -9,6 +9,7 @@
 #include "src/accessors.h"
 #include "src/assembler-inl.h"
 #include "src/ast/prettyprinter.h"
+#include "src/base/functional.h"
 #include "src/callable.h"
 #include "src/disasm.h"
 #include "src/frames-inl.h"
@@ -460,6 +461,9 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction* function,
   }
   if (compiled_code_->kind() == Code::OPTIMIZED_FUNCTION) {
     compiled_code_->set_deopt_already_counted(true);
+    isolate->counters()
+        ->deopt_reason(GetDeoptInfo(compiled_code_, from_).deopt_reason)
+        ->Increment();
     PROFILE(isolate_,
             CodeDeoptEvent(compiled_code_, DeoptKindOfBailoutType(type), from_,
                            fp_to_sp_delta_));
@@ -2077,6 +2081,40 @@ void TranslationBuffer::Add(int32_t value) {
   } while (bits != 0);
 }
 
+int TranslationBuffer::Deduplicate(int index) {
+  size_t start = static_cast<size_t>(index);
+  int length = static_cast<int>(contents_.size() - start);
+
+  size_t hash = base::hash_value(length);
+  for (auto it = contents_.Find(start); it != contents_.end(); ++it) {
+    hash = base::hash_combine(hash, *it);
+  }
+
+  auto lookup = previous_translations_.find(hash);
+  if (lookup == previous_translations_.end()) {
+    previous_translations_.insert({hash, {index, length}});
+    return index;
+  }
+
+  // Compare byte by byte; on a hash collision simply keep the duplicate.
+  int previous_index = lookup->second.first;
+  if (lookup->second.second == length) {
+    auto previous_it = contents_.Find(static_cast<size_t>(previous_index));
+    auto it = contents_.Find(start);
+    int matched = 0;
+    while (matched < length && *previous_it == *it) {
+      ++previous_it;
+      ++it;
+      ++matched;
+    }
+    if (matched == length) {
+      contents_.Rewind(start);
+      return previous_index;
+    }
+  }
+  return index;
+}
+
 TranslationIterator::TranslationIterator(ByteArray* buffer, int index)
     : buffer_(buffer), index_(index) {
   DCHECK(index >= 0 && index < buffer->length());
@@ -15,6 +15,7 @@
 #include "src/macro-assembler.h"
 #include "src/source-position.h"
 #include "src/zone/zone-chunk-list.h"
+#include "src/zone/zone-containers.h"
 
 namespace v8 {
 namespace internal {
@@ -792,15 +793,27 @@ class DeoptimizerData {
 
 class TranslationBuffer BASE_EMBEDDED {
  public:
-  explicit TranslationBuffer(Zone* zone) : contents_(zone) {}
+  explicit TranslationBuffer(Zone* zone)
+      : contents_(zone), previous_translations_(zone) {}
 
   int CurrentIndex() const { return static_cast<int>(contents_.size()); }
   void Add(int32_t value);
 
+  // Called when the translation starting at |index| is complete. If an
+  // identical byte sequence was recorded for an earlier translation, drops
+  // the new bytes and returns the index of the earlier copy; otherwise keeps
+  // them and returns |index|. Deoptimization entries of a Code object often
+  // describe the same frame layout, so sharing their translations
+  // considerably shrinks the deoptimization data.
+  int Deduplicate(int index);
+
   Handle<ByteArray> CreateByteArray(Factory* factory);
 
  private:
   ZoneChunkList<uint8_t> contents_;
+  // Maps the hash of a translation's byte sequence to its start index and
+  // length in |contents_|.
+  ZoneUnorderedMap<size_t, std::pair<int, int>> previous_translations_;
 };
 
 
@@ -146,13 +146,14 @@ void CopyObjectToObjectElements(FixedArrayBase* from_base,
   DCHECK(IsSmiOrObjectElementsKind(from_kind));
   DCHECK(IsSmiOrObjectElementsKind(to_kind));
 
-  WriteBarrierMode write_barrier_mode =
-      (IsObjectElementsKind(from_kind) && IsObjectElementsKind(to_kind))
-          ? UPDATE_WRITE_BARRIER
-          : SKIP_WRITE_BARRIER;
-  for (int i = 0; i < copy_size; i++) {
-    Object* value = from->get(from_start + i);
-    to->set(to_start + i, value, write_barrier_mode);
+  // Copy the slots in bulk and publish them to the write barrier afterwards,
+  // the same way Heap::MoveElements does. Only object-to-object copies can
+  // carry heap object values and thus need the barrier.
+  MemMove(to->data_start() + to_start, from->data_start() + from_start,
+          copy_size * kPointerSize);
+  if (IsObjectElementsKind(from_kind) && IsObjectElementsKind(to_kind)) {
+    FIXED_ARRAY_ELEMENTS_WRITE_BARRIER(from->GetHeap(), to, to_start,
+                                       copy_size);
   }
 }
 
@@ -2149,6 +2150,20 @@ class FastElementsAccessor : public ElementsAccessorBase<Subclass, KindTraits> {
     Isolate* isolate = receiver->GetIsolate();
     Handle<FixedArrayBase> backing_store(receiver->elements(), isolate);
     int result_len = end < start ? 0u : end - start;
+    // A full-length slice of a smi-or-object array can share the backing
+    // store copy-on-write instead of copying it, the way arrays created
+    // from literals already do. Shorter prefix slices must keep copying:
+    // trained store handlers and the push builtin write into capacity past
+    // the result's length without consulting the elements map, and with a
+    // longer source array those writes would be observable through it.
+    if (IsSmiOrObjectElementsKind(KindTraits::Kind) && start == 0 &&
+        result_len > 0 && receiver->IsJSArray() &&
+        end == static_cast<uint32_t>(
+                   Smi::ToInt(JSArray::cast(*receiver)->length()))) {
+      backing_store->set_map(isolate->heap()->fixed_cow_array_map());
+      return isolate->factory()->NewJSArrayWithElements(
+          backing_store, KindTraits::Kind, result_len);
+    }
     Handle<JSArray> result_array = isolate->factory()->NewJSArray(
         KindTraits::Kind, result_len, result_len);
     DisallowHeapAllocation no_gc;
@@ -2368,6 +2383,22 @@ class FastElementsAccessor : public ElementsAccessorBase<Subclass, KindTraits> {
           // and trust UCOMISD or similar operation for result
           auto elements = FixedArray::cast(receiver->elements());
 
+          if (IsSmiElementsKind(Subclass::kind())) {
+            // All elements are smis, so the search value can only match if
+            // it has a smi representation, and then numeric equality is
+            // equality of the tagged words (the hole never equals a smi).
+            int smi_value = 0;
+            if (search_value != 0 &&  // SameValueZero: -0 matches 0.
+                !DoubleToSmiInteger(search_value, &smi_value)) {
+              return Just(false);
+            }
+            Smi* smi = Smi::FromInt(smi_value);
+            for (uint32_t k = start_from; k < length; ++k) {
+              if (elements->get(k) == smi) return Just(true);
+            }
+            return Just(false);
+          }
+
           for (uint32_t k = start_from; k < length; ++k) {
             Object* element_k = elements->get(k);
             if (element_k->IsNumber() && element_k->Number() == search_value) {
@@ -2645,6 +2676,22 @@ class FastSmiOrObjectElementsAccessor
     if (value->IsNaN()) return Just<int64_t>(-1);
 
     FixedArray* elements = FixedArray::cast(receiver->elements());
+    if (IsSmiElementsKind(Subclass::kind())) {
+      // All elements are smis, so the search value can only match if it has
+      // a smi representation, and then strict equality is equality of the
+      // tagged words (the hole never equals a smi).
+      double number = value->Number();
+      int smi_value = 0;
+      if (number != 0 &&  // Strict equality: -0 matches 0.
+          !DoubleToSmiInteger(number, &smi_value)) {
+        return Just<int64_t>(-1);
+      }
+      Smi* smi = Smi::FromInt(smi_value);
+      for (uint32_t k = start_from; k < length; ++k) {
+        if (elements->get(k) == smi) return Just<int64_t>(k);
+      }
+      return Just<int64_t>(-1);
+    }
     for (uint32_t k = start_from; k < length; ++k) {
       if (value->StrictEquals(elements->get(k))) return Just<int64_t>(k);
     }
@@ -9,6 +9,7 @@
 #include "src/ast/ast-source-ranges.h"
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
+#include "src/base/functional.h"
 #include "src/bootstrapper.h"
 #include "src/compiler.h"
 #include "src/conversions.h"
@@ -1387,6 +1388,33 @@ Handle<Object> Factory::NewNumber(double value,
 }
 
 
+Handle<Object> Factory::NewCanonicalNumber(double value) {
+  // Materialize as a SMI if possible; smis are canonical by construction.
+  int32_t int_value;
+  if (DoubleToSmiInteger(value, &int_value)) {
+    return handle(Smi::FromInt(int_value), isolate());
+  }
+
+  // Compare bit patterns rather than values so that distinct NaNs and the
+  // two zeros keep their exact representation.
+  int64_t bits = bit_cast<int64_t>(value);
+  Handle<FixedArray> cache = constant_pool_number_cache();
+  int hash =
+      static_cast<int>(base::hash_value(bits)) & (cache->length() - 1);
+  Object* cached = cache->get(hash);
+  if (cached->IsHeapNumber() &&
+      bit_cast<int64_t>(HeapNumber::cast(cached)->value()) == bits) {
+    return handle(cached, isolate());
+  }
+
+  // We tenure the allocated number since it is referenced from the canonical
+  // number cache which lives in the old space.
+  Handle<HeapNumber> number = NewHeapNumber(value, IMMUTABLE, TENURED);
+  cache->set(hash, *number);
+  return number;
+}
+
+
 Handle<Object> Factory::NewNumberFromInt(int32_t value,
                                          PretenureFlag pretenure) {
   if (Smi::IsValid(value)) return handle(Smi::FromInt(value), isolate());
@@ -2697,9 +2725,11 @@ Handle<Object> Factory::GetNumberStringCache(Handle<Object> number) {
   Object* key = number_string_cache()->get(hash * 2);
   if (key == *number || (key->IsHeapNumber() && number->IsHeapNumber() &&
                          key->Number() == number->Number())) {
+    isolate()->counters()->number_string_cache_hits()->Increment();
     return Handle<String>(
         String::cast(number_string_cache()->get(hash * 2 + 1)), isolate());
   }
+  isolate()->counters()->number_string_cache_misses()->Increment();
   return undefined_value();
 }
 
@@ -2712,7 +2742,10 @@ void Factory::SetNumberStringCache(Handle<Object> number,
     if (number_string_cache()->length() != full_size) {
       Handle<FixedArray> new_cache = NewFixedArray(full_size, TENURED);
       isolate()->heap()->set_number_string_cache(*new_cache);
-      return;
+      // Cache the pair in the enlarged cache rather than dropping it; the
+      // entry that triggered the conflict stays behind in the old cache,
+      // which is now garbage.
+      hash = NumberCacheHash(number_string_cache(), number);
     }
   }
   number_string_cache()->set(hash * 2, *number);
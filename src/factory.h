@@ -462,6 +462,12 @@ class V8_EXPORT_PRIVATE Factory final {
   Handle<Object> NewNumber(double value,
                            PretenureFlag pretenure = NOT_TENURED);
 
+  // As NewNumber, but reuses an existing, immutable heap number with the
+  // same value when the canonical number cache holds one. Intended for
+  // numbers referenced from long-lived structures such as bytecode constant
+  // pools, where the same literals recur across many compiled functions.
+  Handle<Object> NewCanonicalNumber(double value);
+
   Handle<Object> NewNumberFromInt(int32_t value,
                                   PretenureFlag pretenure = NOT_TENURED);
   Handle<Object> NewNumberFromUint(uint32_t value,
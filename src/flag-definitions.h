@@ -198,7 +198,9 @@ DEFINE_IMPLICATION(harmony_import_meta, harmony_dynamic_import)
   V(harmony_function_sent, "harmony function.sent")                   \
   V(harmony_do_expressions, "harmony do-expressions")                 \
   V(harmony_class_fields, "harmony public fields in class literals")  \
-  V(harmony_bigint, "harmony arbitrary precision integers")
+  V(harmony_bigint, "harmony arbitrary precision integers")           \
+  V(harmony_atomics_bulk_operations,                                  \
+    "harmony Atomics.copy and Atomics.fill")
 
 // Features that are complete (but still behind --harmony/es-staging flag).
 #define HARMONY_STAGED_BASE(V)                                          \
@@ -321,6 +323,10 @@ DEFINE_BOOL_READONLY(string_slices, false, "use string slices")
 // Flags for Ignition.
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
             "elide bytecodes which won't have any external effect")
+DEFINE_BOOL(ignition_fuse_bytecodes, false,
+            "fuse common bytecode pairs into single fused bytecodes")
+DEFINE_BOOL(ignition_reorder_cold_blocks, true,
+            "lay out statically cold if-branches behind the hot path")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
@@ -455,6 +461,9 @@ DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
+DEFINE_BOOL(turbo_align_cold_code, true,
+            "align deferred code on a cache line boundary so that cold code "
+            "does not share instruction cache lines with the hot path")
 DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
@@ -610,6 +619,9 @@ DEFINE_BOOL(trace_fragmentation_verbose, false,
 DEFINE_BOOL(trace_evacuation, false, "report evacuation statistics")
 DEFINE_BOOL(trace_mutator_utilization, false,
             "print mutator utilization, allocation speed, gc speed")
+DEFINE_BOOL(flush_bytecode, false,
+            "flush the bytecode of functions that have not been executed "
+            "recently, forcing recompilation on the next call")
 DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_wrappers, true,
             "use incremental marking for marking wrappers")
@@ -633,9 +645,17 @@ DEFINE_BOOL(black_allocation, true, "use black allocation")
 DEFINE_BOOL(concurrent_store_buffer, true,
             "use concurrent store buffer processing")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
+DEFINE_BOOL(concurrent_array_buffer_freeing, true,
+            "free array buffer backing stores on a background thread")
+DEFINE_BOOL(lock_free_swept_code_pages, true,
+            "publish swept code-space pages through a lock-free stack "
+            "instead of the sweeper mutex")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
+DEFINE_BOOL(parallel_string_table_clearing, true,
+            "prune large string tables with parallel tasks during the "
+            "full-GC atomic pause")
 DEFINE_BOOL(trace_incremental_marking, false,
             "trace progress of the incremental marking")
 DEFINE_BOOL(track_gc_object_stats, false,
@@ -662,6 +682,12 @@ DEFINE_BOOL(verify_heap_skip_remembered_set, false,
             "disable remembered set verification")
 #endif
 DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
+DEFINE_BOOL(numa_first_touch_pages, false,
+            "pre-fault new- and old-space pages on the allocating thread so "
+            "NUMA first-touch placement keeps them node-local")
+DEFINE_BOOL(per_context_heap_stats, false,
+            "record approximate per-native-context object sizes at full-GC "
+            "epochs")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
@@ -793,6 +819,13 @@ DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 DEFINE_BOOL(compiler_dispatcher, false, "enable compiler dispatcher")
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
+DEFINE_BOOL(compile_ahead, false,
+            "record lazily compiled functions in code caches and compile them "
+            "on the compiler dispatcher when consuming the cache")
+DEFINE_INT(compile_ahead_profile_window, 10,
+           "number of seconds after isolate creation during which lazy "
+           "compilations are recorded for --compile-ahead")
+DEFINE_IMPLICATION(compile_ahead, compiler_dispatcher)
 
 // compiler-dispatcher-job.cc
 DEFINE_BOOL(
@@ -951,7 +984,15 @@ DEFINE_VALUE_IMPLICATION(runtime_call_stats, runtime_stats, 1)
 // snapshot-common.cc
 DEFINE_BOOL(lazy_deserialization, true,
             "Deserialize code lazily from the snapshot.")
+DEFINE_BOOL(lazy_handler_deserialization, true,
+            "Deserialize bytecode handlers lazily from the snapshot.")
+DEFINE_IMPLICATION(lazy_handler_deserialization, lazy_deserialization)
 DEFINE_BOOL(trace_lazy_deserialization, false, "Trace lazy deserialization.")
+DEFINE_BOOL(compress_snapshot, false,
+            "Compress the startup and context sections of the snapshot blob "
+            "(only has an effect when creating the snapshot).")
+DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
+            "Verify the snapshot blob checksum when initializing the isolate.")
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(serialization_statistics, false,
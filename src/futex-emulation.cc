@@ -16,24 +16,61 @@
 namespace v8 {
 namespace internal {
 
-base::LazyMutex FutexEmulation::mutex_ = LAZY_MUTEX_INITIALIZER;
-base::LazyInstance<FutexWaitList>::type FutexEmulation::wait_list_ =
-    LAZY_INSTANCE_INITIALIZER;
+base::LazyMutex FutexEmulation::mutexes_[FutexEmulation::kShardCount] = {
+    LAZY_MUTEX_INITIALIZER, LAZY_MUTEX_INITIALIZER, LAZY_MUTEX_INITIALIZER,
+    LAZY_MUTEX_INITIALIZER, LAZY_MUTEX_INITIALIZER, LAZY_MUTEX_INITIALIZER,
+    LAZY_MUTEX_INITIALIZER, LAZY_MUTEX_INITIALIZER, LAZY_MUTEX_INITIALIZER,
+    LAZY_MUTEX_INITIALIZER, LAZY_MUTEX_INITIALIZER, LAZY_MUTEX_INITIALIZER,
+    LAZY_MUTEX_INITIALIZER, LAZY_MUTEX_INITIALIZER, LAZY_MUTEX_INITIALIZER,
+    LAZY_MUTEX_INITIALIZER};
+base::LazyInstance<FutexWaitList>::type
+    FutexEmulation::wait_lists_[FutexEmulation::kShardCount] = {
+        LAZY_INSTANCE_INITIALIZER, LAZY_INSTANCE_INITIALIZER,
+        LAZY_INSTANCE_INITIALIZER, LAZY_INSTANCE_INITIALIZER,
+        LAZY_INSTANCE_INITIALIZER, LAZY_INSTANCE_INITIALIZER,
+        LAZY_INSTANCE_INITIALIZER, LAZY_INSTANCE_INITIALIZER,
+        LAZY_INSTANCE_INITIALIZER, LAZY_INSTANCE_INITIALIZER,
+        LAZY_INSTANCE_INITIALIZER, LAZY_INSTANCE_INITIALIZER,
+        LAZY_INSTANCE_INITIALIZER, LAZY_INSTANCE_INITIALIZER,
+        LAZY_INSTANCE_INITIALIZER, LAZY_INSTANCE_INITIALIZER};
+base::Atomic32 FutexEmulation::num_waiters_[FutexEmulation::kShardCount];
+
+
+// static
+int FutexEmulation::ShardIndex(void* backing_store, size_t addr) {
+  uintptr_t key = reinterpret_cast<uintptr_t>(backing_store) + addr;
+  // The waited-on address is always 4-byte aligned, so drop the low bits.
+  return static_cast<int>((key >> 2) & (kShardCount - 1));
+}
 
 
 void FutexWaitListNode::NotifyWake() {
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
-  // will have been unlocked if we are currently waiting on the condition
-  // variable.
+  // Lock the shard mutex before notifying. We know that the mutex will have
+  // been unlocked if we are currently waiting on the condition variable.
   //
   // The mutex may also not be locked if the other thread is currently handling
   // interrupts, or if FutexEmulation::Wait was just called and the mutex
   // hasn't been locked yet. In either of those cases, we set the interrupted
   // flag to true, which will be tested after the mutex is re-locked.
-  base::LockGuard<base::Mutex> lock_guard(FutexEmulation::mutex_.Pointer());
-  if (waiting_) {
-    cond_.NotifyOne();
-    interrupted_ = true;
+  //
+  // The shard index we read may be stale by the time we lock the shard: the
+  // owning thread may concurrently start a wait on a different address. It
+  // only moves the node while holding the old shard's mutex, though, so
+  // re-checking the index after locking detects the move.
+  while (true) {
+    base::AtomicWord shard_index = base::Acquire_Load(&shard_index_);
+    if (shard_index < 0) {
+      // The node has never waited; there is no wait to interrupt.
+      return;
+    }
+    base::LockGuard<base::Mutex> lock_guard(
+        FutexEmulation::mutexes_[shard_index].Pointer());
+    if (base::Acquire_Load(&shard_index_) != shard_index) continue;
+    if (waiting_) {
+      cond_.NotifyOne();
+      interrupted_ = true;
+    }
+    return;
   }
 }
 
@@ -81,14 +118,42 @@ Object* FutexEmulation::Wait(Isolate* isolate,
   int32_t* p =
       reinterpret_cast<int32_t*>(static_cast<int8_t*>(backing_store) + addr);
 
-  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
+  FutexWaitListNode* node = isolate->futex_wait_list_node();
+
+  int shard_index = ShardIndex(backing_store, addr);
+  base::Mutex* mutex = mutexes_[shard_index].Pointer();
+
+  // Move the node to the shard for this address. NotifyWake synchronizes on
+  // the mutex of the shard recorded in the node, so the node may only change
+  // shards while the old shard's mutex is held; lock both in index order to
+  // avoid deadlock with another thread doing the opposite move.
+  base::AtomicWord old_index = base::Acquire_Load(&node->shard_index_);
+  if (old_index == shard_index || old_index < 0) {
+    mutex->Lock();
+    base::Release_Store(&node->shard_index_, shard_index);
+  } else {
+    base::Mutex* old_mutex = mutexes_[old_index].Pointer();
+    if (old_index < shard_index) {
+      old_mutex->Lock();
+      mutex->Lock();
+    } else {
+      mutex->Lock();
+      old_mutex->Lock();
+    }
+    base::Release_Store(&node->shard_index_, shard_index);
+    old_mutex->Unlock();
+  }
+
+  // Register as a waiter before checking the value, so that a waker that
+  // observes a zero waiter count can be sure we will see its store.
+  base::Barrier_AtomicIncrement(&num_waiters_[shard_index], 1);
 
   if (*p != value) {
+    base::Barrier_AtomicIncrement(&num_waiters_[shard_index], -1);
+    mutex->Unlock();
     return isolate->heap()->not_equal();
   }
 
-  FutexWaitListNode* node = isolate->futex_wait_list_node();
-
   node->backing_store_ = backing_store;
   node->wait_addr_ = addr;
   node->waiting_ = true;
@@ -116,7 +181,7 @@ Object* FutexEmulation::Wait(Isolate* isolate,
   base::TimeTicks timeout_time = start_time + rel_timeout;
   base::TimeTicks current_time = start_time;
 
-  wait_list_.Pointer()->AddNode(node);
+  wait_lists_[shard_index].Pointer()->AddNode(node);
 
   Object* result;
 
@@ -125,18 +190,18 @@ Object* FutexEmulation::Wait(Isolate* isolate,
     node->interrupted_ = false;
 
     // Unlock the mutex here to prevent deadlock from lock ordering between
-    // mutex_ and mutexes locked by HandleInterrupts.
-    mutex_.Pointer()->Unlock();
+    // the shard mutex and mutexes locked by HandleInterrupts.
+    mutex->Unlock();
 
     // Because the mutex is unlocked, we have to be careful about not dropping
     // an interrupt. The notification can happen in three different places:
     // 1) Before Wait is called: the notification will be dropped, but
     //    interrupted_ will be set to 1. This will be checked below.
-    // 2) After interrupted has been checked here, but before mutex_ is
-    //    acquired: interrupted is checked again below, with mutex_ locked.
-    //    Because the wakeup signal also acquires mutex_, we know it will not
-    //    be able to notify until mutex_ is released below, when waiting on the
-    //    condition variable.
+    // 2) After interrupted has been checked here, but before the mutex is
+    //    acquired: interrupted is checked again below, with the mutex locked.
+    //    Because the wakeup signal also acquires the mutex, we know it will
+    //    not be able to notify until the mutex is released below, when
+    //    waiting on the condition variable.
     // 3) After the mutex is released in the call to WaitFor(): this
     // notification will wake up the condition variable. node->waiting() will
     // be false, so we'll loop and then check interrupts.
@@ -144,15 +209,15 @@ Object* FutexEmulation::Wait(Isolate* isolate,
       Object* interrupt_object = isolate->stack_guard()->HandleInterrupts();
       if (interrupt_object->IsException(isolate)) {
         result = interrupt_object;
-        mutex_.Pointer()->Lock();
+        mutex->Lock();
         break;
       }
     }
 
-    mutex_.Pointer()->Lock();
+    mutex->Lock();
 
     if (node->interrupted_) {
-      // An interrupt occurred while the mutex_ was unlocked. Don't wait yet.
+      // An interrupt occurred while the mutex was unlocked. Don't wait yet.
       continue;
     }
 
@@ -172,17 +237,19 @@ Object* FutexEmulation::Wait(Isolate* isolate,
       base::TimeDelta time_until_timeout = timeout_time - current_time;
       DCHECK_GE(time_until_timeout.InMicroseconds(), 0);
       bool wait_for_result =
-          node->cond_.WaitFor(mutex_.Pointer(), time_until_timeout);
+          node->cond_.WaitFor(mutex, time_until_timeout);
       USE(wait_for_result);
     } else {
-      node->cond_.Wait(mutex_.Pointer());
+      node->cond_.Wait(mutex);
     }
 
     // Spurious wakeup, interrupt or timeout.
   }
 
-  wait_list_.Pointer()->RemoveNode(node);
+  wait_lists_[shard_index].Pointer()->RemoveNode(node);
   node->waiting_ = false;
+  base::Barrier_AtomicIncrement(&num_waiters_[shard_index], -1);
+  mutex->Unlock();
 
   return result;
 }
@@ -195,8 +262,19 @@ Object* FutexEmulation::Wake(Isolate* isolate,
   int waiters_woken = 0;
   void* backing_store = array_buffer->backing_store();
 
-  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
-  FutexWaitListNode* node = wait_list_.Pointer()->head_;
+  int shard_index = ShardIndex(backing_store, addr);
+
+  // Fast path: nobody is waiting on this shard. A waiter registers itself in
+  // the count with a full barrier before it re-checks the wait value, and the
+  // caller's store to the value precedes this call, so a waiter missed here
+  // is guaranteed to observe the current value and return "not-equal" rather
+  // than sleep.
+  if (base::Acquire_Load(&num_waiters_[shard_index]) == 0) {
+    return Smi::FromInt(0);
+  }
+
+  base::LockGuard<base::Mutex> lock_guard(mutexes_[shard_index].Pointer());
+  FutexWaitListNode* node = wait_lists_[shard_index].Pointer()->head_;
   while (node && num_waiters_to_wake > 0) {
     if (backing_store == node->backing_store_ && addr == node->wait_addr_) {
       node->waiting_ = false;
@@ -220,10 +298,11 @@ Object* FutexEmulation::NumWaitersForTesting(Isolate* isolate,
   DCHECK(addr < NumberToSize(array_buffer->byte_length()));
   void* backing_store = array_buffer->backing_store();
 
-  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
+  int shard_index = ShardIndex(backing_store, addr);
+  base::LockGuard<base::Mutex> lock_guard(mutexes_[shard_index].Pointer());
 
   int waiters = 0;
-  FutexWaitListNode* node = wait_list_.Pointer()->head_;
+  FutexWaitListNode* node = wait_lists_[shard_index].Pointer()->head_;
   while (node) {
     if (backing_store == node->backing_store_ && addr == node->wait_addr_ &&
         node->waiting_) {
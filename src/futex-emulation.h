@@ -42,6 +42,7 @@ class FutexWaitListNode {
         next_(nullptr),
         backing_store_(nullptr),
         wait_addr_(0),
+        shard_index_(-1),
         waiting_(false),
         interrupted_(false) {}
 
@@ -56,6 +57,12 @@ class FutexWaitListNode {
   FutexWaitListNode* next_;
   void* backing_store_;
   size_t wait_addr_;
+  // Index of the shard whose mutex protects this node's waiting_ and
+  // interrupted_ fields, or -1 if the node has never waited. Written only by
+  // the owning thread in FutexEmulation::Wait, while holding both the old and
+  // the new shard's mutex, so that NotifyWake can lock the shard it read and
+  // then re-check that the node has not moved.
+  base::AtomicWord shard_index_;
   bool waiting_;
   bool interrupted_;
 
@@ -110,8 +117,22 @@ class FutexEmulation : public AllStatic {
  private:
   friend class FutexWaitListNode;
 
-  static base::LazyMutex mutex_;
-  static base::LazyInstance<FutexWaitList>::type wait_list_;
+  // Waits are sharded by the waited-on address so that unrelated agents do
+  // not contend on a single global lock. Must be a power of two.
+  static const int kShardCount = 16;
+
+  // Maps a (backing store, address) pair to its shard. Waiters and wakers
+  // for the same address always agree on the shard; unrelated addresses
+  // sharing a shard only costs extra list traversal.
+  static int ShardIndex(void* backing_store, size_t addr);
+
+  static base::LazyMutex mutexes_[kShardCount];
+  static base::LazyInstance<FutexWaitList>::type wait_lists_[kShardCount];
+  // Number of registered waiters per shard. Incremented with a full barrier
+  // before a waiter re-checks the wait value, so a waker that reads zero can
+  // skip taking the shard mutex: any not-yet-registered waiter is guaranteed
+  // to still observe the woken value and bail out with "not-equal".
+  static base::Atomic32 num_waiters_[kShardCount];
 };
 }  // namespace internal
 }  // namespace v8
@@ -44,7 +44,7 @@
 #include "src/heap/store-buffer.h"
 #include "src/interpreter/interpreter.h"
 #include "src/objects/object-macros.h"
-#include "src/objects/shared-function-info.h"
+#include "src/objects/shared-function-info-inl.h"
 #include "src/regexp/jsregexp.h"
 #include "src/runtime-profiler.h"
 #include "src/snapshot/natives.h"
@@ -103,6 +103,24 @@ void Heap::SetSerializedTemplates(FixedArray* templates) {
   set_serialized_templates(templates);
 }
 
+void Heap::SetDeserializeLazyHandler(Code* code) {
+  set_deserialize_lazy_handler(code);
+}
+
+void Heap::SetDeserializeLazyHandlerWide(Code* code) {
+  set_deserialize_lazy_handler_wide(code);
+}
+
+void Heap::SetDeserializeLazyHandlerExtraWide(Code* code) {
+  set_deserialize_lazy_handler_extra_wide(code);
+}
+
+bool Heap::IsDeserializeLazyHandler(Code* code) {
+  return (code == deserialize_lazy_handler() ||
+          code == deserialize_lazy_handler_wide() ||
+          code == deserialize_lazy_handler_extra_wide());
+}
+
 void Heap::SetSerializedGlobalProxySizes(FixedArray* sizes) {
   DCHECK_EQ(empty_fixed_array(), serialized_global_proxy_sizes());
   DCHECK(isolate()->serializer_enabled());
@@ -145,6 +163,7 @@ Heap::Heap()
     : external_memory_(0),
       external_memory_limit_(kExternalAllocationSoftLimit),
       external_memory_at_last_mark_compact_(0),
+      backing_store_free_task_pending_(false),
       isolate_(nullptr),
       code_range_size_(0),
       // semispace_size_ should be a power of 2 and old_generation_size_ should
@@ -220,6 +239,7 @@ Heap::Heap()
       ring_buffer_full_(false),
       ring_buffer_end_(0),
       configured_(false),
+      first_touch_page_placement_(false),
       current_gc_flags_(Heap::kNoGCFlags),
       current_gc_callback_flags_(GCCallbackFlags::kNoGCCallbackFlags),
       external_string_table_(this),
@@ -1216,6 +1236,9 @@ bool Heap::CollectGarbage(AllocationSpace space,
     if (collector == MARK_COMPACTOR && FLAG_track_detached_contexts) {
       isolate()->CheckDetachedContextsAfterGC();
     }
+    if (collector == MARK_COMPACTOR && FLAG_flush_bytecode) {
+      FlushOldBytecode();
+    }
 
     if (collector == MARK_COMPACTOR) {
       size_t committed_memory_after = CommittedOldGenerationMemory();
@@ -1698,6 +1721,36 @@ void Heap::MarkCompactEpilogue() {
 
   PreprocessStackTraces();
   DCHECK(incremental_marking()->IsStopped());
+
+  RecordPerContextObjectSizes();
+}
+
+void Heap::RecordPerContextObjectSizes() {
+  if (!FLAG_per_context_heap_stats) return;
+  context_sizes_at_last_gc_.clear();
+  // Note that constructing the iterator forces sweeping to complete.
+  HeapIterator iterator(this);
+  for (HeapObject* obj = iterator.next(); obj != nullptr;
+       obj = iterator.next()) {
+    if (!obj->IsJSObject()) continue;
+    // Attribute objects through their constructor function, which covers
+    // objects created by script. Maps without a constructor function, e.g.
+    // for internal objects, are skipped, keeping the counters approximate.
+    Object* maybe_constructor = obj->map()->GetConstructor();
+    if (!maybe_constructor->IsJSFunction()) continue;
+    Context* native_context =
+        JSFunction::cast(maybe_constructor)->native_context();
+    context_sizes_at_last_gc_[native_context->address()] += obj->Size();
+  }
+}
+
+bool Heap::SizeOfObjectsForContextAtLastGC(Context* native_context,
+                                           size_t* size) {
+  if (!FLAG_per_context_heap_stats) return false;
+  auto it = context_sizes_at_last_gc_.find(native_context->address());
+  if (it == context_sizes_at_last_gc_.end()) return false;
+  *size = it->second;
+  return true;
 }
 
 
@@ -1711,6 +1764,7 @@ void Heap::MarkCompactPrologue() {
   isolate_->compilation_cache()->MarkCompactPrologue();
 
   FlushNumberStringCache();
+  FlushConstantPoolNumberCache();
 }
 
 
@@ -1857,13 +1911,24 @@ class ScavengingTask final : public ItemParallelJob::Task {
 
 int Heap::NumberOfScavengeTasks() {
   if (!FLAG_parallel_scavenge) return 1;
-  const int num_scavenge_tasks =
-      static_cast<int>(new_space()->TotalCapacity()) / MB;
-  return Max(
-      1,
-      Min(Min(num_scavenge_tasks, kMaxScavengerTasks),
-          static_cast<int>(
-              V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads())));
+  const int num_cores = static_cast<int>(
+      V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads());
+  int num_scavenge_tasks;
+  if (tracer()->SurvivalEventsRecorded()) {
+    // Base the task count on the amount of memory expected to survive this
+    // cycle instead of on new space capacity. Mostly-dead nurseries are
+    // handled by few tasks while high-survival cycles use all cores.
+    const size_t expected_surviving_bytes = static_cast<size_t>(
+        new_space()->Size() * tracer()->AverageSurvivalRatio() / 100.0);
+    const size_t kSurvivingBytesPerScavengeTask = 512 * KB;
+    num_scavenge_tasks = 1 + static_cast<int>(expected_surviving_bytes /
+                                              kSurvivingBytesPerScavengeTask);
+  } else {
+    // No feedback recorded yet, e.g. for the first scavenge; fall back to
+    // sizing by capacity.
+    num_scavenge_tasks = static_cast<int>(new_space()->TotalCapacity()) / MB;
+  }
+  return Max(1, Min(Min(num_scavenge_tasks, kMaxScavengerTasks), num_cores));
 }
 
 void Heap::Scavenge() {
@@ -2564,6 +2629,7 @@ void Heap::CreateFixedStubs() {
 bool Heap::RootCanBeWrittenAfterInitialization(Heap::RootListIndex root_index) {
   switch (root_index) {
     case kNumberStringCacheRootIndex:
+    case kConstantPoolNumberCacheRootIndex:
     case kCodeStubsRootIndex:
     case kScriptListRootIndex:
     case kMaterializedObjectsRootIndex:
@@ -2625,6 +2691,86 @@ void Heap::FlushNumberStringCache() {
 }
 
 
+void Heap::FlushConstantPoolNumberCache() {
+  // Flush the cache of canonical constant pool numbers, so numbers that are
+  // only referenced from dead constant pools can be collected.
+  int len = constant_pool_number_cache()->length();
+  for (int i = 0; i < len; i++) {
+    constant_pool_number_cache()->set_undefined(i);
+  }
+}
+
+
+void Heap::FlushOldBytecode() {
+  DCHECK(FLAG_flush_bytecode);
+  // The debugger instruments bytecode and expects compiled functions to stay
+  // compiled, so do not flush while it is active.
+  if (isolate()->debug()->is_active()) return;
+
+  std::unordered_set<SharedFunctionInfo*> referenced;
+  std::vector<SharedFunctionInfo*> candidates;
+
+  auto record_deopt_literals = [&referenced](Code* code) {
+    if (code->kind() != Code::OPTIMIZED_FUNCTION) return;
+    DeoptimizationInputData* data =
+        DeoptimizationInputData::cast(code->deoptimization_data());
+    FixedArray* literals = data->LiteralArray();
+    for (int i = 0; i < literals->length(); i++) {
+      Object* literal = literals->get(i);
+      if (literal->IsSharedFunctionInfo()) {
+        referenced.insert(SharedFunctionInfo::cast(literal));
+      }
+    }
+  };
+
+  {
+    // One pass over the heap: collect flush candidates together with the
+    // shared function infos whose bytecode must be preserved. Closures can
+    // enter their bytecode directly through the interpreter entry trampoline,
+    // and optimized code needs the bytecode of inlined functions to
+    // materialize their frames when deoptimizing.
+    HeapIterator iterator(this);
+    for (HeapObject* obj = iterator.next(); obj != nullptr;
+         obj = iterator.next()) {
+      if (obj->IsJSFunction()) {
+        JSFunction* function = JSFunction::cast(obj);
+        referenced.insert(function->shared());
+        record_deopt_literals(function->code());
+      } else if (obj->IsFeedbackVector()) {
+        FeedbackVector* vector = FeedbackVector::cast(obj);
+        referenced.insert(vector->shared_function_info());
+        Code* code = vector->optimized_code();
+        if (code != nullptr) record_deopt_literals(code);
+      } else if (obj->IsSharedFunctionInfo()) {
+        SharedFunctionInfo* shared = SharedFunctionInfo::cast(obj);
+        if (shared->HasBytecodeArray() && shared->allows_lazy_compilation() &&
+            !shared->is_toplevel() && !shared->native() &&
+            !shared->HasDebugInfo() && shared->script()->IsScript()) {
+          candidates.push_back(shared);
+        }
+      }
+    }
+  }
+
+  Code* compile_lazy = isolate()->builtins()->builtin(Builtins::kCompileLazy);
+  for (SharedFunctionInfo* shared : candidates) {
+    if (referenced.count(shared) != 0) continue;
+    BytecodeArray* bytecode = shared->bytecode_array();
+    if (!bytecode->IsOld()) {
+      // Age unreferenced bytecode here as well, so that flushing does not
+      // depend on the concurrent marker visiting it.
+      bytecode->MakeOlder();
+      continue;
+    }
+    // The function has not run for several full GCs and no closure is left
+    // that could call it without going through lazy compilation again: drop
+    // the bytecode. The next call recompiles it from source.
+    shared->ClearBytecodeArray();
+    shared->set_code(compile_lazy);
+  }
+}
+
+
 Map* Heap::MapForFixedTypedArray(ExternalArrayType array_type) {
   return Map::cast(roots_[RootIndexForFixedTypedArray(array_type)]);
 }
@@ -4259,6 +4405,66 @@ bool Heap::RecentIdleNotificationHappened() {
          MonotonicallyIncreasingTimeInMs();
 }
 
+class BackingStoreFreeTask : public CancelableTask {
+ public:
+  explicit BackingStoreFreeTask(Heap* heap)
+      : CancelableTask(heap->isolate()), heap_(heap) {}
+
+  virtual ~BackingStoreFreeTask() {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override { heap_->FreeQueuedBackingStores(); }
+
+  Heap* heap_;
+  DISALLOW_COPY_AND_ASSIGN(BackingStoreFreeTask);
+};
+
+void Heap::QueueBackingStoreForConcurrentFree(
+    void* allocation_base, size_t allocation_length,
+    ArrayBuffer::Allocator::AllocationMode allocation_mode) {
+  // Bound the backlog so that a burst of dying buffers cannot accumulate an
+  // arbitrary amount of unfreed memory behind a slow background thread.
+  const size_t kMaxBacklog = 64;
+  {
+    base::LockGuard<base::Mutex> guard(&backing_store_free_mutex_);
+    if (backing_stores_to_free_.size() < kMaxBacklog) {
+      backing_stores_to_free_.push_back(
+          {allocation_base, allocation_length, allocation_mode});
+      if (!backing_store_free_task_pending_) {
+        backing_store_free_task_pending_ = true;
+        V8::GetCurrentPlatform()->CallOnBackgroundThread(
+            new BackingStoreFreeTask(this), v8::Platform::kShortRunningTask);
+      }
+      return;
+    }
+  }
+  // Backlog full; free synchronously.
+  isolate()->array_buffer_allocator()->Free(allocation_base,
+                                            allocation_length,
+                                            allocation_mode);
+}
+
+void Heap::FreeQueuedBackingStores() {
+  std::vector<QueuedBackingStore> backing_stores;
+  while (true) {
+    {
+      base::LockGuard<base::Mutex> guard(&backing_store_free_mutex_);
+      if (backing_stores_to_free_.empty()) {
+        backing_store_free_task_pending_ = false;
+        return;
+      }
+      backing_stores.swap(backing_stores_to_free_);
+    }
+    for (const QueuedBackingStore& backing_store : backing_stores) {
+      isolate()->array_buffer_allocator()->Free(
+          backing_store.allocation_base, backing_store.allocation_length,
+          backing_store.allocation_mode);
+    }
+    backing_stores.clear();
+  }
+}
+
 class MemoryPressureInterruptTask : public CancelableTask {
  public:
   explicit MemoryPressureInterruptTask(Heap* heap)
@@ -5558,6 +5764,10 @@ void Heap::RegisterExternallyReferencedObject(Object** object) {
 
 void Heap::TearDown() {
   use_tasks_ = false;
+
+  // Background freeing tasks have been canceled by the task manager at this
+  // point; release whatever is still queued.
+  FreeQueuedBackingStores();
 #ifdef VERIFY_HEAP
   if (FLAG_verify_heap) {
     Verify();
@@ -212,6 +212,7 @@ using v8::MemoryPressureLevel;
   V(FixedArray, single_character_string_cache, SingleCharacterStringCache)     \
   V(FixedArray, string_split_cache, StringSplitCache)                          \
   V(FixedArray, regexp_multiple_cache, RegExpMultipleCache)                    \
+  V(FixedArray, constant_pool_number_cache, ConstantPoolNumberCache)           \
   /* Lists and dictionaries */                                                 \
   V(NameDictionary, empty_property_dictionary, EmptyPropertyDictionary)        \
   V(NameDictionary, public_symbol_table, PublicSymbolTable)                    \
@@ -238,6 +239,11 @@ using v8::MemoryPressureLevel;
   V(FixedArray, serialized_templates, SerializedTemplates)                     \
   V(FixedArray, serialized_global_proxy_sizes, SerializedGlobalProxySizes)     \
   V(TemplateList, message_listeners, MessageListeners)                         \
+  /* DeserializeLazy handlers for lazy bytecode handler deserialization */     \
+  V(Object, deserialize_lazy_handler, DeserializeLazyHandler)                  \
+  V(Object, deserialize_lazy_handler_wide, DeserializeLazyHandlerWide)         \
+  V(Object, deserialize_lazy_handler_extra_wide,                               \
+    DeserializeLazyHandlerExtraWide)                                           \
   /* JS Entries */                                                             \
   V(Code, js_entry_code, JsEntryCode)                                          \
   V(Code, js_construct_entry_code, JsConstructEntryCode)
@@ -846,6 +852,14 @@ class Heap {
   void SetSerializedTemplates(FixedArray* templates);
   void SetSerializedGlobalProxySizes(FixedArray* sizes);
 
+  void SetDeserializeLazyHandler(Code* code);
+  void SetDeserializeLazyHandlerWide(Code* code);
+  void SetDeserializeLazyHandlerExtraWide(Code* code);
+
+  // Whether {code} is one of the DeserializeLazy bytecode handlers installed
+  // in not-yet-deserialized interpreter dispatch table entries.
+  bool IsDeserializeLazyHandler(Code* code);
+
   // For post mortem debugging.
   void RememberUnmappedPage(Address page, bool compacted);
 
@@ -863,6 +877,23 @@ class Heap {
     external_memory_concurrently_freed_.SetValue(0);
   }
 
+  // Queues a dead JSArrayBuffer backing store for deallocation on a
+  // background thread, so that only pointer unlinking remains in the GC
+  // pause. Frees synchronously once the backlog is full.
+  void QueueBackingStoreForConcurrentFree(
+      void* allocation_base, size_t allocation_length,
+      ArrayBuffer::Allocator::AllocationMode allocation_mode);
+
+  // Synchronously frees all queued backing stores. Called during tear down
+  // after background tasks have been canceled.
+  void FreeQueuedBackingStores();
+
+  // Returns the approximate number of bytes attributable to
+  // |native_context|, as recorded at the last full GC. Only available when
+  // --per_context_heap_stats is enabled; returns false if no measurement
+  // has been recorded for the context.
+  bool SizeOfObjectsForContextAtLastGC(Context* native_context, size_t* size);
+
   void DeoptMarkedAllocationSites();
 
   bool DeoptMaybeTenuredAllocationSites();
@@ -941,6 +972,16 @@ class Heap {
                      size_t code_range_size_in_mb);
   bool ConfigureHeapDefault();
 
+  // Requests first-touch placement for newly allocated new- and old-space
+  // pages: page memory is pre-faulted on the allocating thread so that the
+  // operating system backs it with memory local to that thread's NUMA node.
+  void set_first_touch_page_placement(bool value) {
+    first_touch_page_placement_ = value;
+  }
+  bool first_touch_page_placement() const {
+    return first_touch_page_placement_;
+  }
+
   // Prepares the heap, setting up memory areas that are needed in the isolate
   // without actually creating any objects.
   bool SetUp();
@@ -1644,6 +1685,7 @@ class Heap {
   static const int kInitialStringTableSize = 2048;
   static const int kInitialEvalCacheSize = 64;
   static const int kInitialNumberStringCacheSize = 256;
+  static const int kConstantPoolNumberCacheSize = 256;
 
   static const int kRememberedUnmappedPages = 128;
 
@@ -1774,6 +1816,14 @@ class Heap {
   // Flush the number to string cache.
   void FlushNumberStringCache();
 
+  // Flush the cache of canonical constant pool numbers.
+  void FlushConstantPoolNumberCache();
+
+  // Flush the bytecode of old, unreferenced functions, making them fall back
+  // to lazy recompilation on their next call. Only used when
+  // --flush-bytecode is on, after a full garbage collection.
+  void FlushOldBytecode();
+
   void ConfigureInitialOldGenerationSize();
 
   bool HasLowYoungGenerationAllocationRate();
@@ -1852,6 +1902,10 @@ class Heap {
   void MarkCompactPrologue();
   void MarkCompactEpilogue();
 
+  // Recomputes context_sizes_at_last_gc_ by walking the heap; only active
+  // when --per_context_heap_stats is enabled.
+  void RecordPerContextObjectSizes();
+
   // Performs a minor collection in new generation.
   void Scavenge();
   void EvacuateYoungGeneration();
@@ -2225,6 +2279,21 @@ class Heap {
   // The amount of memory that has been freed concurrently.
   base::AtomicNumber<intptr_t> external_memory_concurrently_freed_;
 
+  // Dead array buffer backing stores queued for deallocation on a background
+  // thread; see QueueBackingStoreForConcurrentFree.
+  struct QueuedBackingStore {
+    void* allocation_base;
+    size_t allocation_length;
+    ArrayBuffer::Allocator::AllocationMode allocation_mode;
+  };
+  base::Mutex backing_store_free_mutex_;
+  std::vector<QueuedBackingStore> backing_stores_to_free_;
+  bool backing_store_free_task_pending_;
+
+  // Approximate bytes per native context, keyed by context address and
+  // recomputed at full-GC epochs; see RecordPerContextObjectSizes.
+  std::unordered_map<Address, size_t> context_sizes_at_last_gc_;
+
   // This can be calculated directly from a pointer to the heap; however, it is
   // more expedient to get at the isolate directly from within Heap methods.
   Isolate* isolate_;
@@ -2416,6 +2485,8 @@ class Heap {
   // configured through the API until it is set up.
   bool configured_;
 
+  bool first_touch_page_placement_;
+
   // Currently set GC flags that are respected by all GC components.
   int current_gc_flags_;
 
@@ -408,9 +408,18 @@ static int NumberOfAvailableCores() {
              V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads()));
 }
 
-int MarkCompactCollectorBase::NumberOfParallelCompactionTasks(int pages) {
+int MarkCompactCollectorBase::NumberOfParallelCompactionTasks(
+    int pages, intptr_t live_bytes) {
   DCHECK_GT(pages, 0);
-  return FLAG_parallel_compaction ? Min(NumberOfAvailableCores(), pages) : 1;
+  if (!FLAG_parallel_compaction) return 1;
+  // Ensure each spawned task has a reasonable amount of live bytes to
+  // process. Task creation and evacuator finalization otherwise dominate
+  // for mostly-dead candidate sets.
+  const intptr_t kMinLiveBytesPerCompactionTask = 512 * KB;
+  const int wanted_tasks = Min(
+      pages,
+      1 + static_cast<int>(live_bytes / kMinLiveBytesPerCompactionTask));
+  return Min(NumberOfAvailableCores(), wanted_tasks);
 }
 
 int MarkCompactCollectorBase::NumberOfParallelPointerUpdateTasks(int pages,
@@ -461,6 +470,7 @@ MarkCompactCollector::MarkCompactCollector(Heap* heap)
       marking_worklist_(heap),
       sweeper_(heap, non_atomic_marking_state()) {
   old_to_new_slots_ = -1;
+  scanned_weak_collections_ = Smi::kZero;
 }
 
 void MarkCompactCollector::SetUp() {
@@ -740,6 +750,11 @@ void MarkCompactCollector::Sweeper::SweepOrWaitUntilSweepingCompleted(
 
 Page* MarkCompactCollector::Sweeper::GetSweptPageSafe(PagedSpace* space) {
   base::LockGuard<base::Mutex> guard(&mutex_);
+  if (space->identity() == CODE_SPACE && FLAG_lock_free_swept_code_pages) {
+    // |mutex_| only serializes concurrent consumers here; sweeper tasks
+    // publish to the stack without taking it.
+    return swept_code_pages_.Pop();
+  }
   SweptList& list = swept_list_[space->identity()];
   if (!list.empty()) {
     auto last_page = list.back();
@@ -2591,6 +2606,88 @@ void MarkCompactCollector::MarkLiveObjects() {
 }
 
 
+class StringTableClearingItem : public ItemParallelJob::Item {
+ public:
+  StringTableClearingItem(int start, int end) : start_(start), end_(end) {}
+  virtual ~StringTableClearingItem() {}
+
+  int start() const { return start_; }
+  int end() const { return end_; }
+
+ private:
+  int start_;
+  int end_;
+};
+
+class StringTableClearingTask : public ItemParallelJob::Task {
+ public:
+  StringTableClearingTask(Isolate* isolate, Heap* heap, StringTable* table,
+                          base::AtomicNumber<intptr_t>* pointers_removed)
+      : ItemParallelJob::Task(isolate),
+        heap_(heap),
+        table_(table),
+        pointers_removed_(pointers_removed) {}
+
+  void RunInParallel() override {
+    MarkCompactCollector::NonAtomicMarkingState* marking_state =
+        heap_->mark_compact_collector()->non_atomic_marking_state();
+    Object* the_hole = heap_->the_hole_value();
+    intptr_t pointers_removed = 0;
+    StringTableClearingItem* item = nullptr;
+    while ((item = GetItem<StringTableClearingItem>()) != nullptr) {
+      for (int i = item->start(); i < item->end(); i++) {
+        Object** slot = table_->RawFieldOfElementAt(i);
+        Object* o = *slot;
+        if (o->IsHeapObject()) {
+          HeapObject* heap_object = HeapObject::cast(o);
+          if (marking_state->IsWhite(heap_object)) {
+            pointers_removed++;
+            // Set the entry to the_hole_value (as deleted).
+            *slot = the_hole;
+          } else {
+            // StringTable contains only old space strings.
+            DCHECK(!heap_->InNewSpace(o));
+            // Slot recording is safe from multiple threads.
+            MarkCompactCollector::RecordSlot(table_, slot, o);
+          }
+        }
+      }
+      item->MarkFinished();
+    }
+    pointers_removed_->Increment(pointers_removed);
+  }
+
+ private:
+  Heap* const heap_;
+  StringTable* const table_;
+  base::AtomicNumber<intptr_t>* const pointers_removed_;
+};
+
+void MarkCompactCollector::ClearStringTableInParallel(
+    StringTable* string_table) {
+  // Number of table elements processed by each clearing item. Items need to
+  // be small enough for work stealing to balance uneven mark-bit checking
+  // costs across tasks.
+  const int kStringTableClearingSegmentSize = 8 * KB;
+  ItemParallelJob job(isolate()->cancelable_task_manager(),
+                      &page_parallel_job_semaphore_);
+  const int start = StringTable::kElementsStartIndex;
+  const int end = string_table->length();
+  for (int i = start; i < end; i += kStringTableClearingSegmentSize) {
+    job.AddItem(new StringTableClearingItem(
+        i, Min(i + kStringTableClearingSegmentSize, end)));
+  }
+  const int num_tasks = Min(NumberOfAvailableCores(), job.NumberOfItems());
+  base::AtomicNumber<intptr_t> pointers_removed(0);
+  for (int i = 0; i < num_tasks; i++) {
+    job.AddTask(new StringTableClearingTask(isolate(), heap(), string_table,
+                                            &pointers_removed));
+  }
+  job.Run();
+  string_table->ElementsRemoved(
+      static_cast<int>(pointers_removed.Value()));
+}
+
 void MarkCompactCollector::ClearNonLiveReferences() {
   TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR);
 
@@ -2601,9 +2698,18 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     // string table.  Cannot use string_table() here because the string
     // table is marked.
     StringTable* string_table = heap()->string_table();
-    InternalizedStringTableCleaner internalized_visitor(heap(), string_table);
-    string_table->IterateElements(&internalized_visitor);
-    string_table->ElementsRemoved(internalized_visitor.PointersRemoved());
+    // Only parallelize clearing of large tables; task setup dominates
+    // otherwise.
+    const int kParallelClearingThreshold = 16 * KB;
+    if (FLAG_parallel_string_table_clearing &&
+        string_table->NumberOfElements() >= kParallelClearingThreshold) {
+      ClearStringTableInParallel(string_table);
+    } else {
+      InternalizedStringTableCleaner internalized_visitor(heap(),
+                                                          string_table);
+      string_table->IterateElements(&internalized_visitor);
+      string_table->ElementsRemoved(internalized_visitor.PointersRemoved());
+    }
 
     ExternalStringTableCleaner external_visitor(heap());
     heap()->external_string_table_.IterateAll(&external_visitor);
@@ -2848,27 +2954,47 @@ void MarkCompactCollector::TrimEnumCache(Map* map,
 
 void MarkCompactCollector::ProcessWeakCollections() {
   MarkCompactMarkingVisitor visitor(this, marking_state());
+  // Newly encountered weak collections are prepended to the list, so every
+  // collection from |scanned_weak_collections_| on has had its entries
+  // recorded already. Record the entries of the new prefix. The mutator is
+  // stopped during the atomic pause, so tables cannot change between
+  // iterations.
   Object* weak_collection_obj = heap()->encountered_weak_collections();
-  while (weak_collection_obj != Smi::kZero) {
+  while (weak_collection_obj != scanned_weak_collections_) {
     JSWeakCollection* weak_collection =
         reinterpret_cast<JSWeakCollection*>(weak_collection_obj);
     DCHECK(non_atomic_marking_state()->IsBlackOrGrey(weak_collection));
     if (weak_collection->table()->IsHashTable()) {
       ObjectHashTable* table = ObjectHashTable::cast(weak_collection->table());
       for (int i = 0; i < table->Capacity(); i++) {
-        HeapObject* heap_object = HeapObject::cast(table->KeyAt(i));
-        if (non_atomic_marking_state()->IsBlackOrGrey(heap_object)) {
-          Object** key_slot =
-              table->RawFieldOfElementAt(ObjectHashTable::EntryToIndex(i));
-          RecordSlot(table, key_slot, *key_slot);
-          Object** value_slot =
-              table->RawFieldOfElementAt(ObjectHashTable::EntryToValueIndex(i));
-          visitor.VisitPointer(table, value_slot);
-        }
+        unresolved_ephemeron_entries_.push_back(std::make_pair(table, i));
       }
     }
     weak_collection_obj = weak_collection->next();
   }
+  scanned_weak_collections_ = heap()->encountered_weak_collections();
+
+  // Visit the values of all recorded entries whose key has been marked by
+  // now and keep the rest for the next fixpoint iteration. This way each
+  // iteration only touches unresolved entries instead of rescanning every
+  // encountered table.
+  size_t kept = 0;
+  for (size_t i = 0; i < unresolved_ephemeron_entries_.size(); i++) {
+    ObjectHashTable* table = unresolved_ephemeron_entries_[i].first;
+    int entry = unresolved_ephemeron_entries_[i].second;
+    HeapObject* heap_object = HeapObject::cast(table->KeyAt(entry));
+    if (non_atomic_marking_state()->IsBlackOrGrey(heap_object)) {
+      Object** key_slot =
+          table->RawFieldOfElementAt(ObjectHashTable::EntryToIndex(entry));
+      RecordSlot(table, key_slot, *key_slot);
+      Object** value_slot = table->RawFieldOfElementAt(
+          ObjectHashTable::EntryToValueIndex(entry));
+      visitor.VisitPointer(table, value_slot);
+    } else {
+      unresolved_ephemeron_entries_[kept++] = unresolved_ephemeron_entries_[i];
+    }
+  }
+  unresolved_ephemeron_entries_.resize(kept);
 }
 
 
@@ -2892,6 +3018,8 @@ void MarkCompactCollector::ClearWeakCollections() {
     weak_collection->set_next(heap()->undefined_value());
   }
   heap()->set_encountered_weak_collections(Smi::kZero);
+  scanned_weak_collections_ = Smi::kZero;
+  unresolved_ephemeron_entries_.clear();
 }
 
 
@@ -2904,6 +3032,8 @@ void MarkCompactCollector::AbortWeakCollections() {
     weak_collection->set_next(heap()->undefined_value());
   }
   heap()->set_encountered_weak_collections(Smi::kZero);
+  scanned_weak_collections_ = Smi::kZero;
+  unresolved_ephemeron_entries_.clear();
 }
 
 void MarkCompactCollector::ClearWeakCellsAndSimpleMapTransitions(
@@ -3154,6 +3284,13 @@ class Evacuator : public Malloced {
     old_space_visitor_.AddObserver(observer);
   }
 
+  // Hints the amount of live bytes this evacuator is expected to process so
+  // that destination buffers can be reserved up front. Must be called before
+  // the first page is evacuated.
+  void SetExpectedLiveBytes(intptr_t live_bytes) {
+    local_allocator_.SetExpectedEvacuationBytes(live_bytes);
+  }
+
   // Merge back locally cached info sequentially. Note that this method needs
   // to be called from the main thread.
   inline void Finalize();
@@ -3368,6 +3505,32 @@ class PageEvacuationItem : public ItemParallelJob::Item {
   Page* page_;
 };
 
+namespace {
+
+// Adds evacuation items such that the live-byte totals of the contiguous
+// item ranges that ItemParallelJob::Run() assigns to its tasks are roughly
+// balanced: candidates are sorted into descending live-byte order and then
+// dealt round-robin into |num_tasks| stripes. Without this, tasks racing for
+// the few large pages plateau well below the available core count.
+void AddPageEvacuationItemsBalanced(
+    ItemParallelJob* job, std::vector<std::pair<intptr_t, Page*>>* pages,
+    int num_tasks) {
+  DCHECK_GT(num_tasks, 0);
+  std::sort(pages->begin(), pages->end(),
+            [](const std::pair<intptr_t, Page*>& a,
+               const std::pair<intptr_t, Page*>& b) {
+              return a.first > b.first;
+            });
+  const size_t num_pages = pages->size();
+  for (size_t stripe = 0; stripe < static_cast<size_t>(num_tasks); stripe++) {
+    for (size_t i = stripe; i < num_pages; i += num_tasks) {
+      job->AddItem(new PageEvacuationItem((*pages)[i].second));
+    }
+  }
+}
+
+}  // namespace
+
 class PageEvacuationTask : public ItemParallelJob::Task {
  public:
   PageEvacuationTask(Isolate* isolate, Evacuator* evacuator)
@@ -3403,10 +3566,11 @@ void MarkCompactCollectorBase::CreateAndExecuteEvacuationTasks(
   ProfilingMigrationObserver profiling_observer(heap());
 
   const int wanted_num_tasks =
-      NumberOfParallelCompactionTasks(job->NumberOfItems());
+      NumberOfParallelCompactionTasks(job->NumberOfItems(), live_bytes);
   Evacuator** evacuators = new Evacuator*[wanted_num_tasks];
   for (int i = 0; i < wanted_num_tasks; i++) {
     evacuators[i] = new Evacuator(collector, record_visitor);
+    evacuators[i]->SetExpectedLiveBytes(live_bytes / wanted_num_tasks);
     if (profiling) evacuators[i]->AddObserver(&profiling_observer);
     if (migration_observer != nullptr)
       evacuators[i]->AddObserver(migration_observer);
@@ -3444,10 +3608,13 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
   ItemParallelJob evacuation_job(isolate()->cancelable_task_manager(),
                                  &page_parallel_job_semaphore_);
   intptr_t live_bytes = 0;
+  std::vector<std::pair<intptr_t, Page*>> evacuation_items;
 
   for (Page* page : old_space_evacuation_pages_) {
-    live_bytes += non_atomic_marking_state()->live_bytes(page);
-    evacuation_job.AddItem(new PageEvacuationItem(page));
+    const intptr_t live_bytes_on_page =
+        non_atomic_marking_state()->live_bytes(page);
+    live_bytes += live_bytes_on_page;
+    evacuation_items.push_back(std::make_pair(live_bytes_on_page, page));
   }
 
   for (Page* page : new_space_evacuation_pages_) {
@@ -3466,9 +3633,14 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
         EvacuateNewSpacePageVisitor<NEW_TO_NEW>::Move(page);
       }
     }
-    evacuation_job.AddItem(new PageEvacuationItem(page));
+    evacuation_items.push_back(std::make_pair(live_bytes_on_page, page));
   }
-  if (evacuation_job.NumberOfItems() == 0) return;
+  if (evacuation_items.empty()) return;
+
+  AddPageEvacuationItemsBalanced(
+      &evacuation_job, &evacuation_items,
+      NumberOfParallelCompactionTasks(
+          static_cast<int>(evacuation_items.size()), live_bytes));
 
   RecordMigratedSlotVisitor record_visitor(this);
   CreateAndExecuteEvacuationTasks<FullEvacuator>(
@@ -3480,6 +3652,7 @@ void MinorMarkCompactCollector::EvacuatePagesInParallel() {
   ItemParallelJob evacuation_job(isolate()->cancelable_task_manager(),
                                  &page_parallel_job_semaphore_);
   intptr_t live_bytes = 0;
+  std::vector<std::pair<intptr_t, Page*>> evacuation_items;
 
   for (Page* page : new_space_evacuation_pages_) {
     intptr_t live_bytes_on_page = non_atomic_marking_state()->live_bytes(page);
@@ -3492,9 +3665,14 @@ void MinorMarkCompactCollector::EvacuatePagesInParallel() {
         EvacuateNewSpacePageVisitor<NEW_TO_NEW>::Move(page);
       }
     }
-    evacuation_job.AddItem(new PageEvacuationItem(page));
+    evacuation_items.push_back(std::make_pair(live_bytes_on_page, page));
   }
-  if (evacuation_job.NumberOfItems() == 0) return;
+  if (evacuation_items.empty()) return;
+
+  AddPageEvacuationItemsBalanced(
+      &evacuation_job, &evacuation_items,
+      NumberOfParallelCompactionTasks(
+          static_cast<int>(evacuation_items.size()), live_bytes));
 
   YoungGenerationMigrationObserver observer(heap(),
                                             heap()->mark_compact_collector());
@@ -3747,6 +3925,10 @@ void LiveObjectVisitor::RecomputeLiveBytes(MemoryChunk* chunk,
 
 void MarkCompactCollector::Sweeper::AddSweptPageSafe(PagedSpace* space,
                                                      Page* page) {
+  if (space->identity() == CODE_SPACE && FLAG_lock_free_swept_code_pages) {
+    swept_code_pages_.Push(page);
+    return;
+  }
   base::LockGuard<base::Mutex> guard(&mutex_);
   swept_list_[space->identity()].push_back(page);
 }
@@ -4468,7 +4650,9 @@ int MarkCompactCollector::Sweeper::ParallelSweepPage(Page* page,
     }
   }
 
-  {
+  if (identity == CODE_SPACE && FLAG_lock_free_swept_code_pages) {
+    swept_code_pages_.Push(page);
+  } else {
     base::LockGuard<base::Mutex> guard(&mutex_);
     swept_list_[identity].push_back(page);
   }
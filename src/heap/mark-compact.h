@@ -21,7 +21,9 @@ class EvacuationJobTraits;
 class HeapObjectVisitor;
 class ItemParallelJob;
 class MigrationObserver;
+class ObjectHashTable;
 class RecordMigratedSlotVisitor;
+class StringTable;
 class UpdatingItem;
 class YoungGenerationMarkingVisitor;
 
@@ -296,7 +298,7 @@ class MarkCompactCollectorBase {
                                         IterateableSpace* space,
                                         RememberedSetUpdatingMode mode);
 
-  int NumberOfParallelCompactionTasks(int pages);
+  int NumberOfParallelCompactionTasks(int pages, intptr_t live_bytes);
   int NumberOfParallelPointerUpdateTasks(int pages, int slots);
   int NumberOfParallelToSpacePointerUpdateTasks(int pages);
 
@@ -709,6 +711,45 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
    private:
     class SweeperTask;
 
+    // Multiple-producer stack used to publish swept CODE_SPACE pages.
+    // Sweeper tasks push finished pages without taking |mutex_|, so a main
+    // thread refilling the code-space free list never stalls behind a
+    // background task holding the lock. Pops still have to be serialized
+    // externally among consumers, but never contend with producers.
+    class SweptPageStack final {
+     public:
+      SweptPageStack() : top_(nullptr) {}
+      ~SweptPageStack() { DCHECK_NULL(top_.Value()); }
+
+      void Push(Page* page) {
+        Node* node = new Node(page, top_.Value());
+        while (!top_.TrySetValue(node->next, node)) {
+          node->next = top_.Value();
+        }
+      }
+
+      // Requires external serialization of concurrent consumers.
+      Page* Pop() {
+        Node* top;
+        do {
+          top = top_.Value();
+          if (top == nullptr) return nullptr;
+        } while (!top_.TrySetValue(top, top->next));
+        Page* page = top->page;
+        delete top;
+        return page;
+      }
+
+     private:
+      struct Node : public Malloced {
+        Node(Page* page, Node* next) : page(page), next(next) {}
+        Page* page;
+        Node* next;
+      };
+
+      base::AtomicValue<Node*> top_;
+    };
+
     static const int kAllocationSpaces = LAST_PAGED_SPACE + 1;
     static const int kMaxSweeperTasks = kAllocationSpaces;
 
@@ -742,6 +783,7 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
     base::Semaphore pending_sweeper_tasks_semaphore_;
     base::Mutex mutex_;
     SweptList swept_list_[kAllocationSpaces];
+    SweptPageStack swept_code_pages_;
     SweepingList sweeping_list_[kAllocationSpaces];
     bool sweeping_in_progress_;
     // Counter is actively maintained by the concurrent tasks to avoid querying
@@ -903,6 +945,10 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   // Clear non-live references in weak cells, transition and descriptor arrays,
   // and deoptimize dependent code of non-live maps.
   void ClearNonLiveReferences() override;
+  // Prunes dead strings from the string table using parallel tasks so that
+  // the time spent in the atomic pause is bounded by the slowest task
+  // instead of the full table size.
+  void ClearStringTableInParallel(StringTable* string_table);
   void MarkDependentCodeForDeoptimization(DependentCode* list);
   // Checks if the given weak cell is a simple transition from the parent map
   // of the given dead target. If so it clears the transition and trims
@@ -920,7 +966,9 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
 
   // Mark all values associated with reachable keys in weak collections
   // encountered so far.  This might push new object or even new weak maps onto
-  // the marking stack.
+  // the marking stack.  Entries whose key is not yet reachable are recorded
+  // in |unresolved_ephemeron_entries_| so that subsequent fixpoint
+  // iterations only revisit those entries instead of every table.
   void ProcessWeakCollections();
 
   // After all reachable objects have been marked those weak map entries
@@ -999,6 +1047,15 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   MarkingWorklist marking_worklist_;
   WeakObjects weak_objects_;
 
+  // Weak collection entries whose key was not marked when their table was
+  // scanned. Drained by ProcessWeakCollections until a fixpoint is reached
+  // and only valid during the atomic marking pause.
+  std::vector<std::pair<ObjectHashTable*, int>> unresolved_ephemeron_entries_;
+  // Prefix marker into heap()->encountered_weak_collections(): collections
+  // are prepended to that list, so every collection from this one on has
+  // already had its entries recorded.
+  Object* scanned_weak_collections_;
+
   // Candidates for pages that should be evacuated.
   std::vector<Page*> evacuation_candidates_;
   // Pages that are actually processed during evacuation.
@@ -128,6 +128,21 @@ class RememberedSet : public AllStatic {
     }
   }
 
+  // Bulk variant of Iterate(). The callback should take (Address* slots,
+  // int count) and return a bitmask with bit i set iff slots[i] should be
+  // kept. See SlotSet::IterateBulk.
+  template <typename Callback>
+  static void IterateBulk(MemoryChunk* chunk, Callback callback,
+                          SlotSet::EmptyBucketMode mode) {
+    SlotSet* slots = chunk->slot_set<type>();
+    if (slots != nullptr) {
+      size_t pages = (chunk->size() + Page::kPageSize - 1) / Page::kPageSize;
+      for (size_t page = 0; page < pages; page++) {
+        slots[page].IterateBulk(callback, mode);
+      }
+    }
+  }
+
   // Iterates and filters the remembered set in the given memory chunk with
   // the given callback. The callback should take (Address slot) and return
   // SlotCallbackResult.
@@ -99,9 +99,19 @@ void Scavenger::ScavengePage(MemoryChunk* page) {
   PreferredSweepingPage(page);
 
   CodePageMemoryModificationScope memory_modification_scope(page);
-  RememberedSet<OLD_TO_NEW>::Iterate(
+  // Process slots in decoded batches; see SlotSet::IterateBulk. This keeps
+  // the hot scavenging loop free of bitmap bookkeeping.
+  RememberedSet<OLD_TO_NEW>::IterateBulk(
       page,
-      [this](Address addr) { return CheckAndScavengeObject(heap_, addr); },
+      [this](Address* slots, int count) {
+        uint32_t keep_mask = 0;
+        for (int i = 0; i < count; i++) {
+          if (CheckAndScavengeObject(heap_, slots[i]) == KEEP_SLOT) {
+            keep_mask |= 1u << i;
+          }
+        }
+        return keep_mask;
+      },
       SlotSet::KEEP_EMPTY_BUCKETS);
   RememberedSet<OLD_TO_NEW>::IterateTyped(
       page, [this](SlotType type, Address host_addr, Address addr) {
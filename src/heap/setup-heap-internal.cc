@@ -505,6 +505,10 @@ void Heap::CreateInitialObjects() {
   set_number_string_cache(
       *factory->NewFixedArray(kInitialNumberStringCacheSize * 2, TENURED));
 
+  // Allocate cache for canonical constant pool numbers.
+  set_constant_pool_number_cache(
+      *factory->NewFixedArray(kConstantPoolNumberCacheSize, TENURED));
+
   // Allocate cache for single character one byte strings.
   set_single_character_string_cache(
       *factory->NewFixedArray(String::kMaxOneByteCharCode + 1, TENURED));
@@ -620,6 +624,12 @@ void Heap::CreateInitialObjects() {
 
   set_noscript_shared_function_infos(Smi::kZero);
 
+  // The DeserializeLazy handlers are created by SetupInterpreter, which runs
+  // after the initial objects have been set up.
+  set_deserialize_lazy_handler(Smi::kZero);
+  set_deserialize_lazy_handler_wide(Smi::kZero);
+  set_deserialize_lazy_handler_extra_wide(Smi::kZero);
+
   // Initialize context slot cache.
   isolate_->context_slot_cache()->Clear();
 
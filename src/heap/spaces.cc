@@ -1089,6 +1089,18 @@ template void MemoryAllocator::Free<MemoryAllocator::kPreFreeAndQueue>(
 template void MemoryAllocator::Free<MemoryAllocator::kPooledAndQueue>(
     MemoryChunk* chunk);
 
+void MemoryAllocator::PreFaultPageArea(MemoryChunk* chunk) {
+  // Writing to every OS page of the area forces the kernel to back it with
+  // physical memory immediately. With the default first-touch NUMA policy
+  // the memory then ends up on the node of the allocating thread. The area
+  // is freshly mapped and zero-initialized, so the writes are unobservable.
+  const size_t commit_page_size = GetCommitPageSize();
+  for (Address addr = chunk->area_start(); addr < chunk->area_end();
+       addr += commit_page_size) {
+    *reinterpret_cast<volatile byte*>(addr) = 0;
+  }
+}
+
 template <MemoryAllocator::AllocationMode alloc_mode, typename SpaceType>
 Page* MemoryAllocator::AllocatePage(size_t size, SpaceType* owner,
                                     Executability executable) {
@@ -1100,6 +1112,14 @@ Page* MemoryAllocator::AllocatePage(size_t size, SpaceType* owner,
   }
   if (chunk == nullptr) {
     chunk = AllocateChunk(size, size, executable, owner);
+    // Pooled chunks were touched by their previous user already and are
+    // excluded; likewise code pages, whose protection may not allow writes.
+    if (chunk != nullptr && executable == NOT_EXECUTABLE &&
+        (owner->identity() == NEW_SPACE || owner->identity() == OLD_SPACE) &&
+        (FLAG_numa_first_touch_pages ||
+         isolate_->heap()->first_touch_page_placement())) {
+      PreFaultPageArea(chunk);
+    }
   }
   if (chunk == nullptr) return nullptr;
   return owner->InitializePage(chunk, executable);
@@ -1114,6 +1134,9 @@ MemoryAllocator::AllocatePage<MemoryAllocator::kRegular, SemiSpace>(
 template Page*
 MemoryAllocator::AllocatePage<MemoryAllocator::kPooled, SemiSpace>(
     size_t size, SemiSpace* owner, Executability executable);
+template Page*
+MemoryAllocator::AllocatePage<MemoryAllocator::kPooled, PagedSpace>(
+    size_t size, PagedSpace* owner, Executability executable);
 
 LargePage* MemoryAllocator::AllocateLargePage(size_t size,
                                               LargeObjectSpace* owner,
@@ -1627,8 +1650,19 @@ bool PagedSpace::Expand() {
 
   if (!heap()->CanExpandOldGeneration(size)) return false;
 
-  Page* page =
-      heap()->memory_allocator()->AllocatePage(size, this, executable());
+  Page* page;
+  if (executable() == NOT_EXECUTABLE &&
+      size == MemoryChunk::kAllocatableMemory) {
+    // Non-executable spaces grow by standard-sized pages, so they can reuse
+    // a pooled chunk whose address range is still reserved from an earlier
+    // page. Recommitting in place avoids a fresh mmap per page when the heap
+    // grows in bursts; if the pool is empty this falls back to a regular
+    // chunk allocation.
+    page = heap()->memory_allocator()->AllocatePage<MemoryAllocator::kPooled>(
+        size, this, executable());
+  } else {
+    page = heap()->memory_allocator()->AllocatePage(size, this, executable());
+  }
   if (page == nullptr) return false;
   // Pages created during bootstrapping may contain immortal immovable objects.
   if (!heap()->deserialization_complete()) page->MarkNeverEvacuate();
@@ -1782,7 +1816,14 @@ void PagedSpace::ReleasePage(Page* page) {
   }
   AccountUncommitted(page->size());
   accounting_stats_.DecreaseCapacity(page->area_size());
-  heap()->memory_allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(page);
+  if (page->size() == static_cast<size_t>(MemoryChunk::kPageSize) &&
+      page->executable() == NOT_EXECUTABLE) {
+    // Keep the uncommitted address range around for reuse by Expand; pages
+    // shrunk to their high water mark no longer qualify and are unmapped.
+    heap()->memory_allocator()->Free<MemoryAllocator::kPooledAndQueue>(page);
+  } else {
+    heap()->memory_allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(page);
+  }
 }
 
 void PagedSpace::SetReadAndExecutable() {
@@ -3438,7 +3479,12 @@ AllocationResult LargeObjectSpace::AllocateRaw(int object_size,
       Heap::kNoGCFlags, kGCCallbackScheduleIdleGarbageCollection);
   heap()->CreateFillerObjectAt(object->address(), object_size,
                                ClearRecordedSlots::kNo);
-  if (heap()->incremental_marking()->black_allocation()) {
+  // Objects allocated in large object space while marking is on are born
+  // black: they are trivially live and their fields are only populated
+  // afterwards, protected by the write barrier. This keeps multi-megabyte
+  // objects out of the marking worklists even before black allocation has
+  // started for the linear allocation areas.
+  if (FLAG_black_allocation && heap()->incremental_marking()->IsMarking()) {
     heap()->incremental_marking()->marking_state()->WhiteToBlack(object);
   }
   AllocationStep(object_size, object->address(), object_size);
@@ -1425,6 +1425,10 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
   template <typename SpaceType>
   MemoryChunk* AllocatePagePooled(SpaceType* owner);
 
+  // Pre-faults the usable area of a freshly allocated chunk on the calling
+  // thread for NUMA first-touch placement.
+  void PreFaultPageArea(MemoryChunk* chunk);
+
   // Initializes pages in a chunk. Returns the first page address.
   // This function and GetChunkId() are provided for the mark-compact
   // collector to rebuild page headers in the from space, which is
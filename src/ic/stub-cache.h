@@ -81,7 +81,11 @@ class StubCache {
 
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
+  // The secondary table catches the overflow of the primary table, so it
+  // sees the most thrashing under megamorphic access patterns. Sizing it
+  // like the primary table keeps handlers cached through phases that cycle
+  // over more maps and names than the primary table can hold.
+  static const int kSecondaryTableBits = 11;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
 
   // Some magic number used in primary and secondary hash computations.
@@ -63,6 +63,7 @@ void BytecodeArrayWriter::Write(BytecodeNode* node) {
 
   if (exit_seen_in_block_) return;  // Don't emit dead code.
   UpdateExitSeenInBlock(node->bytecode());
+  if (TryFuseWithLastBytecode(node)) return;
   MaybeElideLastBytecode(node->bytecode(), node->source_info().is_valid());
 
   UpdateSourcePositionTable(node);
@@ -186,6 +187,78 @@ void BytecodeArrayWriter::MaybeElideLastBytecode(Bytecode next_bytecode,
   last_bytecode_offset_ = bytecodes()->size();
 }
 
+bool BytecodeArrayWriter::TryFuseWithLastBytecode(
+    const BytecodeNode* const node) {
+  if (!FLAG_ignition_fuse_bytecodes) return false;
+
+  Bytecode fused;
+  if (node->bytecode() == Bytecode::kStar) {
+    switch (last_bytecode_) {
+      case Bytecode::kLdaZero:
+        fused = Bytecode::kLdaZeroStar;
+        break;
+      case Bytecode::kLdaSmi:
+        fused = Bytecode::kLdaSmiStar;
+        break;
+      case Bytecode::kLdaUndefined:
+        fused = Bytecode::kLdaUndefinedStar;
+        break;
+      case Bytecode::kLdaConstant:
+        fused = Bytecode::kLdaConstantStar;
+        break;
+      default:
+        return false;
+    }
+  } else if (last_bytecode_ == Bytecode::kLdar) {
+    switch (node->bytecode()) {
+      case Bytecode::kAdd:
+        fused = Bytecode::kLdarAdd;
+        break;
+      case Bytecode::kSub:
+        fused = Bytecode::kLdarSub;
+        break;
+      default:
+        return false;
+    }
+  } else {
+    return false;
+  }
+
+  // The fused bytecode sits at the offset of the first bytecode of the pair.
+  // The second bytecode's source position can be transferred there, but not
+  // if the first bytecode recorded a position of its own.
+  if (node->source_info().is_valid() && last_bytecode_had_source_info_) {
+    return false;
+  }
+  // The appended operands have to fit into the operand scale the last
+  // bytecode was emitted with. Only fuse unprefixed single-scale emissions; a
+  // prefixed last bytecode starts with kWide or kExtraWide instead of its own
+  // byte.
+  if (node->operand_scale() != OperandScale::kSingle) return false;
+  if (bytecodes()->at(last_bytecode_offset_) !=
+      Bytecodes::ToByte(last_bytecode_)) {
+    return false;
+  }
+
+  // Rewrite the first bytecode in place into the fused form and append the
+  // second bytecode's operands. Labels and try-region boundaries invalidate
+  // last_bytecode_, so no jump or handler target can point at the second
+  // bytecode of the pair.
+  (*bytecodes())[last_bytecode_offset_] = Bytecodes::ToByte(fused);
+  for (int i = 0; i < node->operand_count(); ++i) {
+    bytecodes()->push_back(static_cast<uint8_t>(node->operand(i)));
+  }
+  if (node->source_info().is_valid()) {
+    source_position_table_builder()->AddPosition(
+        static_cast<int>(last_bytecode_offset_),
+        SourcePosition(node->source_info().source_position()),
+        node->source_info().is_statement());
+    last_bytecode_had_source_info_ = true;
+  }
+  last_bytecode_ = fused;
+  return true;
+}
+
 void BytecodeArrayWriter::InvalidateLastBytecode() {
   last_bytecode_ = Bytecode::kIllegal;
 }
@@ -75,6 +75,7 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
   void UpdateExitSeenInBlock(Bytecode bytecode);
 
   void MaybeElideLastBytecode(Bytecode next_bytecode, bool has_source_info);
+  bool TryFuseWithLastBytecode(const BytecodeNode* const node);
   void InvalidateLastBytecode();
 
   ZoneVector<uint8_t>* bytecodes() { return &bytecodes_; }
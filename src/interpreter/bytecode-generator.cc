@@ -1301,6 +1301,18 @@ void BytecodeGenerator::VisitExpressionStatement(ExpressionStatement* stmt) {
 void BytecodeGenerator::VisitEmptyStatement(EmptyStatement* stmt) {
 }
 
+// Returns whether execution of |stmt| statically always ends in a throw, so
+// that the branch selecting it is cold.
+static bool EndsInThrow(Statement* stmt) {
+  while (stmt->IsBlock()) {
+    Block* block = stmt->AsBlock();
+    if (block->statements()->is_empty()) return false;
+    stmt = block->statements()->last();
+  }
+  return stmt->IsExpressionStatement() &&
+         stmt->AsExpressionStatement()->expression()->IsThrow();
+}
+
 void BytecodeGenerator::VisitIfStatement(IfStatement* stmt) {
   ConditionalControlFlowBuilder conditional_builder(
       builder(), block_coverage_builder_, stmt);
@@ -1316,6 +1328,21 @@ void BytecodeGenerator::VisitIfStatement(IfStatement* stmt) {
       conditional_builder.Else();
       Visit(stmt->else_statement());
     }
+  } else if (FLAG_ignition_reorder_cold_blocks && stmt->HasElseStatement() &&
+             EndsInThrow(stmt->then_statement()) &&
+             !EndsInThrow(stmt->else_statement())) {
+    // The then block always ends in a throw, so it is cold: emit the else
+    // block on the fallthrough path to keep the hot code contiguous, and lay
+    // the cold block out behind it.
+    VisitForTest(stmt->condition(), conditional_builder.then_labels(),
+                 conditional_builder.else_labels(), TestFallthrough::kElse);
+
+    conditional_builder.Else();
+    Visit(stmt->else_statement());
+
+    conditional_builder.JumpToEnd();
+    conditional_builder.Then();
+    Visit(stmt->then_statement());
   } else {
     // TODO (oth): If then statement is BreakStatement or id:1013 gh:1022
     // ContinueStatement we can reduce number of generated
@@ -266,6 +266,8 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kLdaCurrentContextSlot:
       case Bytecode::kAdd:
       case Bytecode::kSub:
+      case Bytecode::kLdarAdd:
+      case Bytecode::kLdarSub:
       case Bytecode::kMul:
       case Bytecode::kAddSmi:
       case Bytecode::kSubSmi:
@@ -37,6 +37,18 @@ namespace interpreter {
   V(LdaFalse, AccumulatorUse::kWrite)                                          \
   V(LdaConstant, AccumulatorUse::kWrite, OperandType::kIdx)                    \
                                                                                \
+  /* Fused bytecode pairs (see --ignition-fuse-bytecodes) */                   \
+  V(LdaZeroStar, AccumulatorUse::kWrite, OperandType::kRegOut)                 \
+  V(LdaSmiStar, AccumulatorUse::kWrite, OperandType::kImm,                     \
+    OperandType::kRegOut)                                                      \
+  V(LdaUndefinedStar, AccumulatorUse::kWrite, OperandType::kRegOut)            \
+  V(LdaConstantStar, AccumulatorUse::kWrite, OperandType::kIdx,                \
+    OperandType::kRegOut)                                                      \
+  V(LdarAdd, AccumulatorUse::kWrite, OperandType::kReg, OperandType::kReg,     \
+    OperandType::kIdx)                                                         \
+  V(LdarSub, AccumulatorUse::kWrite, OperandType::kReg, OperandType::kReg,     \
+    OperandType::kIdx)                                                         \
+                                                                               \
   /* Globals */                                                                \
   V(LdaGlobal, AccumulatorUse::kWrite, OperandType::kIdx, OperandType::kIdx)   \
   V(LdaGlobalInsideTypeof, AccumulatorUse::kWrite, OperandType::kIdx,          \
@@ -547,7 +559,11 @@ class V8_EXPORT_PRIVATE Bytecodes final : public AllStatic {
   // e.g. Mov, Star.
   static constexpr bool IsRegisterLoadWithoutEffects(Bytecode bytecode) {
     return bytecode == Bytecode::kMov || bytecode == Bytecode::kPopContext ||
-           bytecode == Bytecode::kPushContext || bytecode == Bytecode::kStar;
+           bytecode == Bytecode::kPushContext || bytecode == Bytecode::kStar ||
+           bytecode == Bytecode::kLdaZeroStar ||
+           bytecode == Bytecode::kLdaSmiStar ||
+           bytecode == Bytecode::kLdaUndefinedStar ||
+           bytecode == Bytecode::kLdaConstantStar;
   }
 
   // Returns true if the bytecode is a conditional jump taking
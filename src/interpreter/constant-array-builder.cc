@@ -192,9 +192,15 @@ Handle<FixedArray> ConstantArrayBuilder::ToFixedArray(Isolate* isolate) {
 #endif
     // Copy objects from slice into array.
     for (size_t i = 0; i < slice->size(); ++i) {
-      Handle<Object> value =
-          slice->At(slice->start_index() + i).ToHandle(isolate);
-      fixed_array->set(array_index++, *value);
+      const Entry& entry = slice->At(slice->start_index() + i);
+      if (entry.IsSmi()) {
+        // Smis (including committed jump table targets) are stored directly;
+        // this avoids creating a handle per entry and needs no write barrier.
+        fixed_array->set(array_index++, entry.smi());
+      } else {
+        Handle<Object> value = entry.ToHandle(isolate);
+        fixed_array->set(array_index++, *value);
+      }
     }
     // Leave holes where reservations led to unused slots.
     size_t padding = slice->capacity() - slice->size();
@@ -379,7 +385,9 @@ Handle<Object> ConstantArrayBuilder::Entry::ToHandle(Isolate* isolate) const {
     case Tag::kRawString:
       return raw_string_->string();
     case Tag::kHeapNumber:
-      return isolate->factory()->NewNumber(heap_number_);
+      // The same double literals recur across many compiled functions, so
+      // share the allocated heap numbers via the canonical number cache.
+      return isolate->factory()->NewCanonicalNumber(heap_number_);
     case Tag::kBigInt:
       // This should never fail: the parser will never create a BigInt
       // literal that cannot be allocated.
@@ -133,6 +133,15 @@ class V8_EXPORT_PRIVATE ConstantArrayBuilder final BASE_EMBEDDED {
              tag_ == Tag::kJumpTableSmi;
     }
 
+    bool IsSmi() const {
+      return tag_ == Tag::kSmi || tag_ == Tag::kJumpTableSmi;
+    }
+
+    Smi* smi() const {
+      DCHECK(IsSmi());
+      return smi_;
+    }
+
     void SetDeferred(Handle<Object> handle) {
       DCHECK_EQ(tag_, Tag::kDeferred);
       tag_ = Tag::kHandle;
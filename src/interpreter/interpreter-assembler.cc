@@ -1270,6 +1270,22 @@ void InterpreterAssembler::DispatchWide(OperandScale operand_scale) {
   DispatchToBytecodeHandlerEntry(target_code_entry, next_bytecode_offset);
 }
 
+void InterpreterAssembler::DeserializeLazyAndDispatch() {
+  Node* context = GetContext();
+  Node* bytecode_offset = BytecodeOffset();
+  Node* bytecode = LoadBytecode(bytecode_offset);
+
+  // The currently executing code was intended to be the handler for the
+  // bytecode at the current offset, but has not yet been deserialized.
+  // Deserialize it (which also patches the dispatch table entry) and
+  // tail-call into the deserialized handler.
+  Node* target_handler = CallRuntime(
+      Runtime::kInterpreterDeserializeLazy, context, SmiTag(bytecode),
+      SmiConstant(static_cast<int>(operand_scale())));
+
+  DispatchToBytecodeHandler(target_handler, bytecode_offset);
+}
+
 void InterpreterAssembler::UpdateInterruptBudgetOnReturn() {
   // TODO (rmcilroy): Investigate whether it is worth supporting self id:1236 gh:1245
   // optimization of primitive functions like FullCodegen.
@@ -1454,7 +1470,10 @@ Node* InterpreterAssembler::ImportRegisterFile(Node* array,
     Node* reg_index = IntPtrSub(IntPtrConstant(Register(0).ToOperand()), index);
     StoreRegister(value, reg_index);
 
-    StoreFixedArrayElement(array, index, StaleRegisterConstant());
+    // The stale register sentinel is an immortal immovable root, so storing
+    // it does not require a write barrier.
+    StoreFixedArrayElement(array, index, StaleRegisterConstant(),
+                           SKIP_WRITE_BARRIER);
 
     var_index.Bind(IntPtrAdd(index, IntPtrConstant(1)));
     Goto(&loop);
@@ -225,6 +225,11 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // Dispatch bytecode as wide operand variant.
   void DispatchWide(OperandScale operand_scale);
 
+  // Deserializes the handler of the bytecode at the current bytecode offset
+  // and tail-calls it. Used by the DeserializeLazy bytecode handlers, see
+  // GenerateDeserializeLazyHandler.
+  void DeserializeLazyAndDispatch();
+
   // Abort with the given bailout reason.
   void Abort(BailoutReason bailout_reason);
   void AbortIfWordNotEqual(compiler::Node* lhs, compiler::Node* rhs,
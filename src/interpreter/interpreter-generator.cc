@@ -79,6 +79,38 @@ IGNITION_HANDLER(LdaConstant, InterpreterAssembler) {
   Dispatch();
 }
 
+// LdaZeroStar <dst>
+//
+// Load literal '0' into the accumulator and register <dst>.
+IGNITION_HANDLER(LdaZeroStar, InterpreterAssembler) {
+  Node* zero_value = NumberConstant(0.0);
+  SetAccumulator(zero_value);
+  StoreRegister(zero_value, BytecodeOperandReg(0));
+  Dispatch();
+}
+
+// LdaSmiStar <imm> <dst>
+//
+// Load an integer literal into the accumulator and register <dst> as a Smi.
+IGNITION_HANDLER(LdaSmiStar, InterpreterAssembler) {
+  Node* smi_int = BytecodeOperandImmSmi(0);
+  SetAccumulator(smi_int);
+  StoreRegister(smi_int, BytecodeOperandReg(1));
+  Dispatch();
+}
+
+// LdaConstantStar <idx> <dst>
+//
+// Load constant literal at |idx| in the constant pool into the accumulator
+// and register <dst>.
+IGNITION_HANDLER(LdaConstantStar, InterpreterAssembler) {
+  Node* index = BytecodeOperandIdx(0);
+  Node* constant = LoadConstantPoolEntry(index);
+  SetAccumulator(constant);
+  StoreRegister(constant, BytecodeOperandReg(1));
+  Dispatch();
+}
+
 // LdaUndefined
 //
 // Load Undefined into the accumulator.
@@ -87,6 +119,16 @@ IGNITION_HANDLER(LdaUndefined, InterpreterAssembler) {
   Dispatch();
 }
 
+// LdaUndefinedStar <dst>
+//
+// Load Undefined into the accumulator and register <dst>.
+IGNITION_HANDLER(LdaUndefinedStar, InterpreterAssembler) {
+  Node* undefined_value = UndefinedConstant();
+  SetAccumulator(undefined_value);
+  StoreRegister(undefined_value, BytecodeOperandReg(0));
+  Dispatch();
+}
+
 // LdaNull
 //
 // Load Null into the accumulator.
@@ -843,6 +885,23 @@ class InterpreterBinaryOpAssembler : public InterpreterAssembler {
     Dispatch();
   }
 
+  // Shared by the fused Ldar+binary-op bytecodes: the right-hand side comes
+  // from the register the elided Ldar would have loaded instead of the
+  // accumulator.
+  void BinaryOpWithRegisterOperands(BinaryOpGenerator generator) {
+    Node* rhs = LoadRegister(BytecodeOperandReg(0));
+    Node* lhs = LoadRegister(BytecodeOperandReg(1));
+    Node* context = GetContext();
+    Node* slot_index = BytecodeOperandIdx(2);
+    Node* feedback_vector = LoadFeedbackVector();
+
+    BinaryOpAssembler binop_asm(state());
+    Node* result = (binop_asm.*generator)(context, lhs, rhs, slot_index,
+                                          feedback_vector, false);
+    SetAccumulator(result);
+    Dispatch();
+  }
+
   void BinaryOpSmiWithFeedback(BinaryOpGenerator generator) {
     Node* lhs = GetAccumulator();
     Node* rhs = BytecodeOperandImmSmi(0);
@@ -872,6 +931,23 @@ IGNITION_HANDLER(Sub, InterpreterBinaryOpAssembler) {
   BinaryOpWithFeedback(&BinaryOpAssembler::Generate_SubtractWithFeedback);
 }
 
+// LdarAdd <rhs> <lhs> <slot>
+//
+// Load register <rhs> into the accumulator, then add register <lhs> to it.
+// Fused form of Ldar+Add.
+IGNITION_HANDLER(LdarAdd, InterpreterBinaryOpAssembler) {
+  BinaryOpWithRegisterOperands(&BinaryOpAssembler::Generate_AddWithFeedback);
+}
+
+// LdarSub <rhs> <lhs> <slot>
+//
+// Load register <rhs> into the accumulator, then subtract it from register
+// <lhs>. Fused form of Ldar+Sub.
+IGNITION_HANDLER(LdarSub, InterpreterBinaryOpAssembler) {
+  BinaryOpWithRegisterOperands(
+      &BinaryOpAssembler::Generate_SubtractWithFeedback);
+}
+
 // Mul <src>
 //
 // Multiply accumulator by register <src>.
@@ -2876,12 +2952,39 @@ DEBUG_BREAK_BYTECODE_LIST(DEBUG_BREAK);
 // Increment the execution count for the given slot. Used for block code
 // coverage.
 IGNITION_HANDLER(IncBlockCounter, InterpreterAssembler) {
+  Label done(this);
+
   Node* closure = LoadRegister(Register::function_closure());
   Node* coverage_array_slot = BytecodeOperandIdxSmi(0);
-  Node* context = GetContext();
 
-  CallRuntime(Runtime::kIncBlockCounter, context, closure, coverage_array_slot);
+  // Increment the counter directly on the CoverageInfo instead of making a
+  // runtime call; this bytecode executes once per block and dominates the
+  // cost of block coverage collection. It's quite possible that a function
+  // contains IncBlockCounter bytecodes, but no coverage info exists, e.g.
+  // because selecting the best-effort coverage collection mode triggered
+  // deletion of all coverage infos. In that case there is nothing to count.
+  Node* shared =
+      LoadObjectField(closure, JSFunction::kSharedFunctionInfoOffset);
+  Node* debug_info =
+      LoadObjectField(shared, SharedFunctionInfo::kDebugInfoOffset);
+  GotoIf(TaggedIsSmi(debug_info), &done);
+  Node* flags = LoadObjectField(debug_info, DebugInfo::kFlagsOffset);
+  GotoIfNot(IsSetSmi(flags, DebugInfo::kHasCoverageInfo), &done);
+
+  Node* coverage_info =
+      LoadObjectField(debug_info, DebugInfo::kCoverageInfoOffset);
+  Node* slot = IntPtrAdd(
+      IntPtrMul(SmiUntag(coverage_array_slot),
+                IntPtrConstant(CoverageInfo::kSlotIndexCount)),
+      IntPtrConstant(CoverageInfo::kFirstSlotIndex +
+                     CoverageInfo::kSlotBlockCountIndex));
+  Node* old_count = LoadFixedArrayElement(coverage_info, slot);
+  // Counts wrap around on overflow, matching Runtime::kIncBlockCounter.
+  StoreFixedArrayElement(coverage_info, slot, SmiAdd(old_count, SmiConstant(1)),
+                         SKIP_WRITE_BARRIER);
+  Goto(&done);
 
+  BIND(&done);
   Dispatch();
 }
 
@@ -3226,6 +3329,39 @@ Handle<Code> GenerateBytecodeHandler(Isolate* isolate, Bytecode bytecode,
   return code;
 }
 
+Handle<Code> GenerateDeserializeLazyHandler(Isolate* isolate,
+                                            OperandScale operand_scale) {
+  Zone zone(isolate->allocator(), ZONE_NAME);
+
+  std::string debug_name = std::string("DeserializeLazy");
+  if (operand_scale > OperandScale::kSingle) {
+    Bytecode prefix_bytecode =
+        Bytecodes::OperandScaleToPrefixBytecode(operand_scale);
+    debug_name = debug_name.append(Bytecodes::ToString(prefix_bytecode));
+  }
+
+  InterpreterDispatchDescriptor descriptor(isolate);
+  compiler::CodeAssemblerState state(
+      isolate, &zone, descriptor, Code::BYTECODE_HANDLER, debug_name.c_str(),
+      Bytecodes::ReturnCount(Bytecode::kIllegal));
+
+  InterpreterAssembler assembler(&state, Bytecode::kIllegal, operand_scale);
+  assembler.DeserializeLazyAndDispatch();
+
+  Handle<Code> code = compiler::CodeAssembler::GenerateCode(&state);
+  PROFILE(isolate,
+          CodeCreateEvent(CodeEventListener::BYTECODE_HANDLER_TAG,
+                          AbstractCode::cast(*code), debug_name.c_str()));
+#ifdef ENABLE_DISASSEMBLER
+  if (FLAG_trace_ignition_codegen) {
+    OFStream os(stdout);
+    code->Disassemble(debug_name.c_str(), os);
+    os << std::flush;
+  }
+#endif  // ENABLE_DISASSEMBLER
+  return code;
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -12,6 +12,9 @@ namespace v8 {
 namespace internal {
 namespace interpreter {
 
+extern Handle<Code> GenerateDeserializeLazyHandler(Isolate* isolate,
+                                                   OperandScale operand_scale);
+
 extern Handle<Code> GenerateBytecodeHandler(Isolate* isolate, Bytecode bytecode,
                                             OperandScale operand_scale);
 
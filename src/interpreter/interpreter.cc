@@ -19,6 +19,7 @@
 #include "src/objects/shared-function-info.h"
 #include "src/parsing/parse-info.h"
 #include "src/setup-isolate.h"
+#include "src/snapshot/snapshot.h"
 #include "src/visitors.h"
 
 namespace v8 {
@@ -87,6 +88,38 @@ Interpreter::Interpreter(Isolate* isolate) : isolate_(isolate) {
   }
 }
 
+Code* Interpreter::GetAndMaybeDeserializeBytecodeHandler(
+    Bytecode bytecode, OperandScale operand_scale) {
+  Code* code = GetBytecodeHandler(bytecode, operand_scale);
+
+  // Already deserialized? Then just return the handler.
+  if (!isolate_->heap()->IsDeserializeLazyHandler(code)) return code;
+
+  DCHECK(FLAG_lazy_handler_deserialization);
+  DCHECK(Bytecodes::BytecodeHasHandler(bytecode, operand_scale));
+
+  // Some handlers are reused for several bytecodes. Make sure we deserialize
+  // the canonical handler, and install it for both the requested and the
+  // reused bytecode.
+  Bytecode maybe_reused_bytecode;
+  if (Bytecodes::ReusesExistingHandler(bytecode, &maybe_reused_bytecode)) {
+    code = GetAndMaybeDeserializeBytecodeHandler(maybe_reused_bytecode,
+                                                 operand_scale);
+    SetBytecodeHandler(bytecode, operand_scale, code);
+    return code;
+  }
+
+  code = Snapshot::DeserializeHandler(isolate_, bytecode, operand_scale);
+
+  DCHECK(code->IsCode());
+  DCHECK_EQ(code->kind(), Code::BYTECODE_HANDLER);
+  DCHECK(!isolate_->heap()->IsDeserializeLazyHandler(code));
+
+  SetBytecodeHandler(bytecode, operand_scale, code);
+
+  return code;
+}
+
 Code* Interpreter::GetBytecodeHandler(Bytecode bytecode,
                                       OperandScale operand_scale) {
   DCHECK(IsDispatchTableInitialized());
@@ -5,6 +5,7 @@
 #include "src/interpreter/setup-interpreter.h"
 
 #include "src/handles-inl.h"
+#include "src/heap/heap.h"
 #include "src/interpreter/bytecodes.h"
 #include "src/interpreter/interpreter-generator.h"
 #include "src/interpreter/interpreter.h"
@@ -47,6 +48,20 @@ void SetupInterpreter::InstallBytecodeHandlers(Interpreter* interpreter) {
 #undef GENERATE_CODE
   }
 
+  // Generate the DeserializeLazy handlers, one for each operand scale. These
+  // are not installed in the dispatch table, but stored as heap roots so that
+  // the deserializer can later replace lazy bytecode handlers by them.
+  Heap* heap = interpreter->isolate_->heap();
+  DCHECK_EQ(Smi::kZero, heap->deserialize_lazy_handler());
+  heap->SetDeserializeLazyHandler(*GenerateDeserializeLazyHandler(
+      interpreter->isolate_, OperandScale::kSingle));
+  DCHECK_EQ(Smi::kZero, heap->deserialize_lazy_handler_wide());
+  heap->SetDeserializeLazyHandlerWide(*GenerateDeserializeLazyHandler(
+      interpreter->isolate_, OperandScale::kDouble));
+  DCHECK_EQ(Smi::kZero, heap->deserialize_lazy_handler_extra_wide());
+  heap->SetDeserializeLazyHandlerExtraWide(*GenerateDeserializeLazyHandler(
+      interpreter->isolate_, OperandScale::kQuadruple));
+
   // Fill unused entries will the illegal bytecode handler.
   size_t illegal_index = Interpreter::GetDispatchTableIndex(
       Bytecode::kIllegal, OperandScale::kSingle);
@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <fstream>  // NOLINT(readability/streams)
 #include <sstream>
 
@@ -127,6 +128,10 @@ void ThreadLocalTop::Free() {
 }
 
 
+#ifdef V8_FAST_TLS_CURRENT_ISOLATE
+__thread Isolate* g_current_isolate_ = nullptr;
+#endif
+
 base::Thread::LocalStorageKey Isolate::isolate_key_;
 base::Thread::LocalStorageKey Isolate::thread_id_key_;
 base::Thread::LocalStorageKey Isolate::per_isolate_thread_data_key_;
@@ -389,7 +394,10 @@ class FrameArrayBuilder {
   }
 
   void AppendStandardFrame(StandardFrame* frame) {
-    std::vector<FrameSummary> frames;
+    // Reuse the summary vector across frames to avoid one heap allocation
+    // per visited frame; error-heavy code captures traces at a high rate.
+    std::vector<FrameSummary>& frames = frame_summaries_;
+    frames.clear();
     frame->Summarize(&frames);
     // A standard frame may include many summarized frames (due to inlining).
     for (size_t i = frames.size(); i != 0 && !full(); i--) {
@@ -557,6 +565,7 @@ class FrameArrayBuilder {
   bool skip_next_frame_ = true;
   bool encountered_strict_function_ = false;
   Handle<FrameArray> elements_;
+  std::vector<FrameSummary> frame_summaries_;
 };
 
 bool GetStackTraceLimit(Isolate* isolate, int* result) {
@@ -2574,6 +2583,9 @@ void Isolate::Deinit() {
 
 void Isolate::SetIsolateThreadLocals(Isolate* isolate,
                                      PerIsolateThreadData* data) {
+#ifdef V8_FAST_TLS_CURRENT_ISOLATE
+  g_current_isolate_ = isolate;
+#endif
   base::Thread::SetThreadLocal(isolate_key_, isolate);
   base::Thread::SetThreadLocal(per_isolate_thread_data_key_, data);
 }
@@ -3609,7 +3621,7 @@ void Isolate::EnqueueMicrotask(Handle<Object> microtask) {
   Handle<FixedArray> queue(heap()->microtask_queue(), this);
   int num_tasks = pending_microtask_count();
   DCHECK(num_tasks <= queue->length());
-  if (num_tasks == 0) {
+  if (num_tasks == 0 && queue->length() == 0) {
     queue = factory()->NewFixedArray(8);
     heap()->set_microtask_queue(*queue);
   } else if (num_tasks == queue->length()) {
@@ -3637,6 +3649,9 @@ void Isolate::RunMicrotasksInternal() {
   if (!pending_microtask_count()) return;
   TRACE_EVENT0("v8.execute", "RunMicrotasks");
   TRACE_EVENT_CALL_STATS_SCOPED(this, "v8", "V8.RunMicrotasks");
+  // Queues larger than this are dropped after processing instead of being
+  // recycled, so a one-off burst of microtasks does not pin a large array.
+  static const int kMicrotaskQueueRecycleLimit = 1024;
   while (pending_microtask_count() > 0) {
     HandleScope scope(this);
     int num_tasks = pending_microtask_count();
@@ -3702,6 +3717,17 @@ void Isolate::RunMicrotasksInternal() {
         }
       }
     });
+
+    // Recycle the drained backing store for the next round of microtasks
+    // unless the tasks above enqueued new ones (in which case a new store
+    // is already installed) or the queue grew unusually large. The slots
+    // are cleared so that the array does not keep the processed microtasks
+    // alive until the next checkpoint.
+    if (pending_microtask_count() == 0 &&
+        queue->length() <= kMicrotaskQueueRecycleLimit) {
+      for (int i = 0; i < num_tasks; i++) queue->set_undefined(i);
+      heap()->set_microtask_queue(*queue);
+    }
   }
 }
 
@@ -3794,6 +3820,31 @@ void Isolate::CheckDetachedContextsAfterGC() {
   }
 }
 
+void Isolate::RecordLazyCompilation(SharedFunctionInfo* shared) {
+  DCHECK(FLAG_compile_ahead);
+  if (time_millis_since_init() >
+      FLAG_compile_ahead_profile_window * 1000.0) {
+    return;
+  }
+  if (!shared->script()->IsScript()) return;
+  // Top-level code is always compiled eagerly and needs no recording.
+  int function_literal_id = shared->function_literal_id();
+  if (function_literal_id <= 0) return;
+  std::vector<int>& profile =
+      lazy_compilation_profile_[Script::cast(shared->script())->id()];
+  // Re-compilation after code flushing may record a function twice.
+  if (std::find(profile.begin(), profile.end(), function_literal_id) ==
+      profile.end()) {
+    profile.push_back(function_literal_id);
+  }
+}
+
+const std::vector<int>* Isolate::LazyCompilationProfile(int script_id) const {
+  auto it = lazy_compilation_profile_.find(script_id);
+  if (it == lazy_compilation_profile_.end()) return nullptr;
+  return &it->second;
+}
+
 double Isolate::LoadStartTimeMs() {
   base::LockGuard<base::Mutex> guard(&rail_mutex_);
   return load_start_time_ms_;
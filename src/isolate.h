@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <memory>
 #include <queue>
+#include <unordered_map>
 #include <vector>
 
 #include "include/v8-debug.h"
@@ -461,6 +462,18 @@ typedef std::vector<HeapObject*> DebugObjectCache;
 #define THREAD_LOCAL_TOP_ADDRESS(type, name) \
   type* name##_address() { return &thread_local_top_.name##_; }
 
+// On platforms where compiler-level TLS is known to be reliable, cache the
+// current isolate in a __thread slot in addition to the base::Thread slot.
+// Isolate::Current() is on every API call boundary, and reading the slot
+// directly avoids the pthread_getspecific call. The base::Thread slot stays
+// authoritative; the cache is updated only by SetIsolateThreadLocals.
+#if defined(__GNUC__) && V8_OS_LINUX && !defined(__ANDROID__) && \
+    !defined(V8_NO_FAST_TLS)
+#define V8_FAST_TLS_CURRENT_ISOLATE 1
+class Isolate;
+extern __thread Isolate* g_current_isolate_;
+#endif
+
 
 class Isolate {
   // These forward declarations are required to make the friend declarations in
@@ -533,8 +546,14 @@ class Isolate {
   // Returns the isolate inside which the current thread is running.
   INLINE(static Isolate* Current()) {
     DCHECK_EQ(base::Relaxed_Load(&isolate_key_created_), 1);
+#ifdef V8_FAST_TLS_CURRENT_ISOLATE
+    Isolate* isolate = g_current_isolate_;
+    DCHECK_EQ(isolate, reinterpret_cast<Isolate*>(
+                           base::Thread::GetThreadLocal(isolate_key_)));
+#else
     Isolate* isolate = reinterpret_cast<Isolate*>(
         base::Thread::GetExistingThreadLocal(isolate_key_));
+#endif
     DCHECK_NOT_NULL(isolate);
     return isolate;
   }
@@ -1265,6 +1284,16 @@ class Isolate {
     return compiler_dispatcher_;
   }
 
+  // Remembers that |shared| was compiled lazily, if we are still within the
+  // --compile-ahead profiling window. Code caches produced for the script
+  // later include the recorded functions, so that the next run can compile
+  // them on the compiler dispatcher ahead of their first call.
+  void RecordLazyCompilation(SharedFunctionInfo* shared);
+
+  // Returns the function literal ids recorded for the script, or nullptr if
+  // none were. The result is invalidated by further recording.
+  const std::vector<int>* LazyCompilationProfile(int script_id) const;
+
   bool IsInAnyContext(Object* object, uint32_t index);
 
   void SetHostImportModuleDynamicallyCallback(
@@ -1565,6 +1594,10 @@ class Isolate {
 
   CompilerDispatcher* compiler_dispatcher_;
 
+  // Function literal ids of lazily compiled functions, keyed by script id.
+  // See RecordLazyCompilation.
+  std::unordered_map<int, std::vector<int>> lazy_compilation_profile_;
+
   typedef std::pair<InterruptCallback, void*> InterruptEntry;
   std::queue<InterruptEntry> api_interrupts_queue_;
 
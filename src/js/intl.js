@@ -2031,10 +2031,45 @@ var defaultObjects = {
   'dateformattime': UNDEFINED,
 };
 
+// Instances created with a single string locale and no options argument,
+// keyed by service and locale. localeCompare and the toLocale*String
+// methods are typically called many times with the same locale, and
+// creating a service instance costs orders of magnitude more than this
+// lookup. Reading an options bag or a locale array is observable through
+// property accesses, so only the string-locale, no-options case can be
+// cached safely.
+var serviceLocaleObjects = {
+  'collator': {__proto__: null},
+  'numberformat': {__proto__: null},
+  'dateformatall': {__proto__: null},
+  'dateformatdate': {__proto__: null},
+  'dateformattime': {__proto__: null}
+};
+
+var serviceLocaleCounts = {
+  'collator': 0,
+  'numberformat': 0,
+  'dateformatall': 0,
+  'dateformatdate': 0,
+  'dateformattime': 0
+};
+
+// Bounds the per-service caches; on overflow a cache is simply dropped,
+// which keeps locale churn from growing it without paying for per-entry
+// LRU bookkeeping.
+var MAX_CACHED_SERVICE_LOCALES = 8;
+
 function clearDefaultObjects() {
   defaultObjects['dateformatall'] = UNDEFINED;
   defaultObjects['dateformatdate'] = UNDEFINED;
   defaultObjects['dateformattime'] = UNDEFINED;
+  // Date formats bake in the time zone, so the keyed ones go stale as well.
+  serviceLocaleObjects['dateformatall'] = {__proto__: null};
+  serviceLocaleObjects['dateformatdate'] = {__proto__: null};
+  serviceLocaleObjects['dateformattime'] = {__proto__: null};
+  serviceLocaleCounts['dateformatall'] = 0;
+  serviceLocaleCounts['dateformatdate'] = 0;
+  serviceLocaleCounts['dateformattime'] = 0;
 }
 
 var date_cache_version = 0;
@@ -2062,6 +2097,19 @@ function cachedOrNewService(service, locales, options, defaults) {
     }
     return defaultObjects[service];
   }
+  if (IS_STRING(locales) && IS_UNDEFINED(options)) {
+    checkDateCacheCurrent();
+    var cached = serviceLocaleObjects[service][locales];
+    if (!IS_UNDEFINED(cached)) return cached;
+    if (serviceLocaleCounts[service] >= MAX_CACHED_SERVICE_LOCALES) {
+      serviceLocaleObjects[service] = {__proto__: null};
+      serviceLocaleCounts[service] = 0;
+    }
+    cached = new savedObjects[service](locales, useOptions);
+    serviceLocaleObjects[service][locales] = cached;
+    serviceLocaleCounts[service]++;
+    return cached;
+  }
   return new savedObjects[service](locales, useOptions);
 }
 
@@ -534,7 +534,10 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
     builder_.AppendCharacter('{');
     Indent();
     bool comma = false;
-    for (int i = 0; i < map->NumberOfOwnDescriptors(); i++) {
+    // The descriptor count of |map| cannot change while we hold a handle to
+    // it, even if serializing a property value mutates |object|.
+    int limit = map->NumberOfOwnDescriptors();
+    for (int i = 0; i < limit; i++) {
       Handle<Name> name(map->instance_descriptors()->GetKey(i), isolate_);
       // TODO (rossberg): Should this throw? id:1311 gh:1319
       if (!name->IsString()) continue;
@@ -640,13 +643,18 @@ void JsonStringifier::SerializeStringUnchecked_(
   // The <uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
 
+  // Scan for characters that need escaping and copy the clean spans
+  // between them in bulk; most strings contain no escapes at all.
+  int copied = 0;
   for (int i = 0; i < src.length(); i++) {
     SrcChar c = src[i];
-    if (DoNotEscape(c)) {
-      dest->Append(c);
-    } else {
-      dest->AppendCString(&JsonEscapeTable[c * kJsonEscapeTableEntrySize]);
-    }
+    if (DoNotEscape(c)) continue;
+    if (i > copied) dest->AppendChars(src.SubVector(copied, i));
+    dest->AppendCString(&JsonEscapeTable[c * kJsonEscapeTableEntrySize]);
+    copied = i + 1;
+  }
+  if (src.length() > copied) {
+    dest->AppendChars(src.SubVector(copied, src.length()));
   }
 }
 
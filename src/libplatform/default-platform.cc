@@ -238,7 +238,14 @@ void DefaultPlatform::RunIdleTasks(v8::Isolate* isolate,
 void DefaultPlatform::CallOnBackgroundThread(Task* task,
                                              ExpectedRuntime expected_runtime) {
   EnsureInitialized();
-  queue_.Append(task);
+  // Tasks declared long-running go to the low priority lane so that they
+  // cannot delay short latency-sensitive tasks behind them in the shared
+  // worker queue. All of V8's own background tasks are posted as short
+  // running.
+  TaskQueue::Priority priority = expected_runtime == kLongRunningTask
+                                     ? TaskQueue::Priority::kLow
+                                     : TaskQueue::Priority::kHigh;
+  queue_.Append(task, priority);
 }
 
 void DefaultPlatform::ScheduleOnForegroundThread(v8::Isolate* isolate,
@@ -17,14 +17,19 @@ TaskQueue::TaskQueue() : process_queue_semaphore_(0), terminated_(false) {}
 TaskQueue::~TaskQueue() {
   base::LockGuard<base::Mutex> guard(&lock_);
   DCHECK(terminated_);
-  DCHECK(task_queue_.empty());
+  DCHECK(high_priority_queue_.empty());
+  DCHECK(low_priority_queue_.empty());
 }
 
 
-void TaskQueue::Append(Task* task) {
+void TaskQueue::Append(Task* task, Priority priority) {
   base::LockGuard<base::Mutex> guard(&lock_);
   DCHECK(!terminated_);
-  task_queue_.push(task);
+  if (priority == Priority::kHigh) {
+    high_priority_queue_.push(task);
+  } else {
+    low_priority_queue_.push(task);
+  }
   process_queue_semaphore_.Signal();
 }
 
@@ -33,9 +38,14 @@ Task* TaskQueue::GetNext() {
   for (;;) {
     {
       base::LockGuard<base::Mutex> guard(&lock_);
-      if (!task_queue_.empty()) {
-        Task* result = task_queue_.front();
-        task_queue_.pop();
+      if (!high_priority_queue_.empty()) {
+        Task* result = high_priority_queue_.front();
+        high_priority_queue_.pop();
+        return result;
+      }
+      if (!low_priority_queue_.empty()) {
+        Task* result = low_priority_queue_.front();
+        low_priority_queue_.pop();
         return result;
       }
       if (terminated_) {
@@ -59,7 +69,7 @@ void TaskQueue::BlockUntilQueueEmptyForTesting() {
   for (;;) {
     {
       base::LockGuard<base::Mutex> guard(&lock_);
-      if (task_queue_.empty()) return;
+      if (high_priority_queue_.empty() && low_priority_queue_.empty()) return;
     }
     base::OS::Sleep(base::TimeDelta::FromMilliseconds(5));
   }
@@ -21,11 +21,16 @@ namespace platform {
 
 class V8_PLATFORM_EXPORT TaskQueue {
  public:
+  // Priority lanes within the queue. High priority tasks are handed out
+  // before any low priority task, regardless of insertion order; within a
+  // lane, tasks are processed in FIFO order.
+  enum class Priority { kHigh, kLow };
+
   TaskQueue();
   ~TaskQueue();
 
   // Appends a task to the queue. The queue takes ownership of |task|.
-  void Append(Task* task);
+  void Append(Task* task, Priority priority = Priority::kHigh);
 
   // Returns the next task to process. Blocks if no task is available. Returns
   // nullptr if the queue is terminated.
@@ -41,7 +46,8 @@ class V8_PLATFORM_EXPORT TaskQueue {
 
   base::Semaphore process_queue_semaphore_;
   base::Mutex lock_;
-  std::queue<Task*> task_queue_;
+  std::queue<Task*> high_priority_queue_;
+  std::queue<Task*> low_priority_queue_;
   bool terminated_;
 
   DISALLOW_COPY_AND_ASSIGN(TaskQueue);
@@ -20,23 +20,37 @@ int DescriptorLookupCache::Hash(Object* source, Name* name) {
       static_cast<uint32_t>(reinterpret_cast<uintptr_t>(source)) >>
       kPointerSizeLog2;
   uint32_t name_hash = name->hash_field();
-  return (source_hash ^ name_hash) % kLength;
+  return (source_hash ^ name_hash) % kSets;
 }
 
 int DescriptorLookupCache::Lookup(Map* source, Name* name) {
-  int index = Hash(source, name);
-  Key& key = keys_[index];
-  if ((key.source == source) && (key.name == name)) return results_[index];
+  int set = Hash(source, name);
+  for (int way = 0; way < kWays; ++way) {
+    Entry& entry = entries_[set][way];
+    if (entry.source == source && entry.name == name) {
+      int result = entry.result;
+      if (way != 0) {
+        // Move the entry to the front of its set, so that the entries a set
+        // holds are its most recently used ones.
+        Entry hit = entry;
+        for (int i = way; i > 0; --i) entries_[set][i] = entries_[set][i - 1];
+        entries_[set][0] = hit;
+      }
+      return result;
+    }
+  }
   return kAbsent;
 }
 
 void DescriptorLookupCache::Update(Map* source, Name* name, int result) {
   DCHECK_NE(result, kAbsent);
-  int index = Hash(source, name);
-  Key& key = keys_[index];
-  key.source = source;
-  key.name = name;
-  results_[index] = result;
+  // Insert at the front of the set, evicting the least recently used entry.
+  int set = Hash(source, name);
+  for (int i = kWays - 1; i > 0; --i) entries_[set][i] = entries_[set][i - 1];
+  Entry& entry = entries_[set][0];
+  entry.source = source;
+  entry.name = name;
+  entry.result = result;
 }
 
 }  // namespace internal
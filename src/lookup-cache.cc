@@ -10,7 +10,11 @@ namespace v8 {
 namespace internal {
 
 void DescriptorLookupCache::Clear() {
-  for (int index = 0; index < kLength; index++) keys_[index].source = nullptr;
+  for (int set = 0; set < kSets; set++) {
+    for (int way = 0; way < kWays; way++) {
+      entries_[set][way].source = nullptr;
+    }
+  }
 }
 
 }  // namespace internal
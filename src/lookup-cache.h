@@ -30,23 +30,30 @@ class DescriptorLookupCache {
 
  private:
   DescriptorLookupCache() {
-    for (int i = 0; i < kLength; ++i) {
-      keys_[i].source = nullptr;
-      keys_[i].name = nullptr;
-      results_[i] = kAbsent;
+    for (int set = 0; set < kSets; ++set) {
+      for (int way = 0; way < kWays; ++way) {
+        entries_[set][way].source = nullptr;
+        entries_[set][way].name = nullptr;
+        entries_[set][way].result = kAbsent;
+      }
     }
   }
 
   static inline int Hash(Object* source, Name* name);
 
-  static const int kLength = 64;
-  struct Key {
+  // The cache is set-associative: a key hashes to a set of kWays entries
+  // kept in recency order, so a handful of hot (map, name) pairs that
+  // collide on the same set no longer evict each other.
+  static const int kSets = 64;
+  static const int kWays = 4;
+
+  struct Entry {
     Map* source;
     Name* name;
+    int result;
   };
 
-  Key keys_[kLength];
-  int results_[kLength];
+  Entry entries_[kSets][kWays];
 
   friend class Isolate;
   DISALLOW_COPY_AND_ASSIGN(DescriptorLookupCache);
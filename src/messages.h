@@ -370,6 +370,8 @@ class ErrorUtils : public AllStatic {
     "Super constructor % of anonymous class is not a constructor")             \
   T(NotIntegerSharedTypedArray, "% is not an integer shared typed array.")     \
   T(NotInt32SharedTypedArray, "% is not an int32 shared typed array.")         \
+  T(NotSameSharedTypedArrayType,                                               \
+    "Source and destination must be shared typed arrays of the same type")     \
   T(ObjectGetterExpectingFunction,                                             \
     "Object.prototype.__defineGetter__: Expecting function")                   \
   T(ObjectGetterCallable, "Getter must be a function: %")                      \
@@ -26,6 +26,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
 #include "src/isolate-inl.h"
+#include "src/counters.h"
 #include "src/isolate.h"
 #include "src/keys.h"
 #include "src/layout-descriptor-inl.h"
@@ -2182,8 +2183,11 @@ int DescriptorArray::SearchWithCache(Isolate* isolate, Name* name, Map* map) {
   int number = cache->Lookup(map, name);
 
   if (number == DescriptorLookupCache::kAbsent) {
+    isolate->counters()->descriptor_lookup_cache_misses()->Increment();
     number = Search(name, number_of_own_descriptors);
     cache->Update(map, name, number);
+  } else {
+    isolate->counters()->descriptor_lookup_cache_hits()->Increment();
   }
 
   return number;
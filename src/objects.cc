@@ -11153,13 +11153,16 @@ Handle<FixedArray> String::CalculateLineEnds(Handle<String> src,
 }
 
 
-// Compares the contents of two strings by reading and comparing
-// int-sized blocks of characters.
+// Compares the contents of two equally-sized-character strings for
+// equality. Unlike an ordering comparison, equality can use memcmp for
+// two-byte characters as well, since the byte order within a character
+// does not affect the result; memcmp in turn compares whole vector-sized
+// blocks per iteration.
 template <typename Char>
 static inline bool CompareRawStringContents(const Char* const a,
                                             const Char* const b,
                                             int length) {
-  return CompareChars(a, b, length) == 0;
+  return memcmp(a, b, length * sizeof(Char)) == 0;
 }
 
 
@@ -13929,8 +13932,9 @@ int AbstractCode::SourcePosition(int offset) {
   int position = 0;
   // Subtract one because the current PC is one instruction after the call site.
   if (IsCode()) offset--;
-  for (SourcePositionTableIterator iterator(source_position_table());
-       !iterator.done() && iterator.code_offset() <= offset;
+  SourcePositionTableIterator iterator(source_position_table());
+  if (!iterator.done()) iterator.SeekForward(offset);
+  for (; !iterator.done() && iterator.code_offset() <= offset;
        iterator.Advance()) {
     position = iterator.source_position().ScriptOffset();
   }
@@ -18788,7 +18792,16 @@ void JSArrayBuffer::FreeBackingStore() {
   using AllocationMode = ArrayBuffer::Allocator::AllocationMode;
   const size_t length = allocation_length();
   const AllocationMode mode = allocation_mode();
-  GetIsolate()->array_buffer_allocator()->Free(allocation_base(), length, mode);
+  Isolate* isolate = GetIsolate();
+  if (FLAG_concurrent_array_buffer_freeing &&
+      isolate->heap()->gc_state() != Heap::NOT_IN_GC) {
+    // Deallocating large backing stores (often munmap) is expensive; keep
+    // it out of GC pauses and only unlink the pointers here.
+    isolate->heap()->QueueBackingStoreForConcurrentFree(allocation_base(),
+                                                        length, mode);
+  } else {
+    isolate->array_buffer_allocator()->Free(allocation_base(), length, mode);
+  }
 
   // Zero out the backing store and allocation base to avoid dangling
   // pointers.
@@ -57,13 +57,8 @@ MaybeHandle<BigInt> BigInt::Exponentiate(Handle<BigInt> base,
 Handle<BigInt> BigInt::Multiply(Handle<BigInt> x, Handle<BigInt> y) {
   if (x->is_zero()) return x;
   if (y->is_zero()) return y;
-  Handle<BigInt> result =
-      x->GetIsolate()->factory()->NewBigInt(x->length() + y->length());
-  for (int i = 0; i < x->length(); i++) {
-    MultiplyAccumulate(y, x->digit(i), result, i);
-  }
+  Handle<BigInt> result = AbsoluteMul(x, y);
   result->set_sign(x->sign() != y->sign());
-  result->RightTrim();
   return result;
 }
 
@@ -939,6 +934,95 @@ void BigInt::MultiplyAccumulate(Handle<BigInt> multiplicand, digit_t multiplier,
   }
 }
 
+// Multiplies the absolute values of {x} and {y}. The result is canonical
+// (right-trimmed) and always has the sign bit unset.
+Handle<BigInt> BigInt::AbsoluteMul(Handle<BigInt> x, Handle<BigInt> y) {
+  if (x->length() < y->length()) std::swap(x, y);
+  if (y->is_zero()) return y;
+  if (y->length() < kKaratsubaThreshold) return AbsoluteMulSchoolbook(x, y);
+  return AbsoluteMulKaratsuba(x, y);
+}
+
+// Quadratic "long multiplication", fastest for small inputs.
+Handle<BigInt> BigInt::AbsoluteMulSchoolbook(Handle<BigInt> x,
+                                             Handle<BigInt> y) {
+  Handle<BigInt> result =
+      x->GetIsolate()->factory()->NewBigInt(x->length() + y->length());
+  for (int i = 0; i < x->length(); i++) {
+    MultiplyAccumulate(y, x->digit(i), result, i);
+  }
+  result->RightTrim();
+  return result;
+}
+
+// Karatsuba multiplication: splits the inputs at {half} digits and computes
+// the product from three recursive half-length products instead of four,
+// which pays off once the inputs are big enough to amortize the extra
+// additions and subtractions. For x == x1*2^(half*kDigitBits) + x0 and
+// equivalently split y:
+//   x*y == z2 << (2*half) + z1 << half + z0
+// with z2 == x1*y1, z0 == x0*y0 and z1 == (x0+x1)*(y0+y1) - z2 - z0.
+Handle<BigInt> BigInt::AbsoluteMulKaratsuba(Handle<BigInt> x,
+                                            Handle<BigInt> y) {
+  DCHECK(x->length() >= y->length());
+  Isolate* isolate = x->GetIsolate();
+  int half = (x->length() + 1) / 2;
+  Handle<BigInt> result =
+      isolate->factory()->NewBigInt(x->length() + y->length());
+  Handle<BigInt> x0 = SliceDigits(x, 0, half);
+  Handle<BigInt> x1 = SliceDigits(x, half, x->length() - half);
+  if (y->length() <= half) {
+    // {y} is too short to split; compute the halves of {x} separately:
+    // x*y == (x1*y << half) + x0*y.
+    AccumulateAt(result, AbsoluteMul(x0, y), 0);
+    AccumulateAt(result, AbsoluteMul(x1, y), half);
+  } else {
+    Handle<BigInt> y0 = SliceDigits(y, 0, half);
+    Handle<BigInt> y1 = SliceDigits(y, half, y->length() - half);
+    Handle<BigInt> z0 = AbsoluteMul(x0, y0);
+    Handle<BigInt> z2 = AbsoluteMul(x1, y1);
+    // z1 == x0*y1 + x1*y0 is non-negative, so the subtractions can be
+    // performed on absolute values.
+    Handle<BigInt> z1 =
+        AbsoluteMul(AbsoluteAdd(x0, x1, false), AbsoluteAdd(y0, y1, false));
+    z1 = AbsoluteSub(z1, z2, false);
+    z1 = AbsoluteSub(z1, z0, false);
+    AccumulateAt(result, z0, 0);
+    AccumulateAt(result, z1, half);
+    AccumulateAt(result, z2, 2 * half);
+  }
+  result->RightTrim();
+  return result;
+}
+
+// Returns a positive BigInt consisting of {length} digits of {x} starting
+// at digit {start}.
+Handle<BigInt> BigInt::SliceDigits(Handle<BigInt> x, int start, int length) {
+  DCHECK(start + length <= x->length());
+  Handle<BigInt> result = x->GetIsolate()->factory()->NewBigIntRaw(length);
+  for (int i = 0; i < length; i++) {
+    result->set_digit(i, x->digit(start + i));
+  }
+  result->RightTrim();
+  return result;
+}
+
+// Adds the absolute value of {summand} into {accumulator}, starting with
+// {summand}'s 0th digit at {accumulator}'s {start_index}th digit, and
+// propagates the carry into the following digits. Callers must ensure that
+// the sum fits into {accumulator}.
+void BigInt::AccumulateAt(Handle<BigInt> accumulator, Handle<BigInt> summand,
+                          int start_index) {
+  digit_t carry = accumulator->InplaceAdd(*summand, start_index);
+  for (int i = start_index + summand->length(); carry != 0; i++) {
+    DCHECK(i < accumulator->length());
+    digit_t new_carry = 0;
+    accumulator->set_digit(
+        i, digit_add(accumulator->digit(i), carry, &new_carry));
+    carry = new_carry;
+  }
+}
+
 // Multiplies {source} with {factor} and adds {summand} to the result.
 // {result} and {source} may be the same BigInt for inplace modification.
 void BigInt::InternalMultiplyAdd(BigInt* source, digit_t factor,
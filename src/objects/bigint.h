@@ -143,6 +143,17 @@ class V8_EXPORT_PRIVATE BigInt : public HeapObject {
 
   static int AbsoluteCompare(Handle<BigInt> x, Handle<BigInt> y);
 
+  // Multiplication is done in the schoolbook way below this length (in
+  // digits) and with Karatsuba's algorithm above it.
+  static const int kKaratsubaThreshold = 34;
+  static Handle<BigInt> AbsoluteMul(Handle<BigInt> x, Handle<BigInt> y);
+  static Handle<BigInt> AbsoluteMulSchoolbook(Handle<BigInt> x,
+                                              Handle<BigInt> y);
+  static Handle<BigInt> AbsoluteMulKaratsuba(Handle<BigInt> x,
+                                             Handle<BigInt> y);
+  static Handle<BigInt> SliceDigits(Handle<BigInt> x, int start, int length);
+  static void AccumulateAt(Handle<BigInt> accumulator, Handle<BigInt> summand,
+                           int start_index);
   static void MultiplyAccumulate(Handle<BigInt> multiplicand,
                                  digit_t multiplier, Handle<BigInt> accumulator,
                                  int accumulator_index);
@@ -168,20 +168,21 @@ class CoverageInfo : public FixedArray {
   // Print debug info.
   void Print(String* function_name);
 
- private:
-  static int FirstIndexForSlot(int slot_index) {
-    return kFirstSlotIndex + slot_index * kSlotIndexCount;
-  }
-
   static const int kFirstSlotIndex = 0;
 
   // Each slot is assigned a group of indices starting at kFirstSlotIndex.
-  // Within this group, semantics are as follows:
+  // Within this group, semantics are as follows. These are also used by the
+  // IncBlockCounter bytecode handler to update counts without a runtime call.
   static const int kSlotStartSourcePositionIndex = 0;
   static const int kSlotEndSourcePositionIndex = 1;
   static const int kSlotBlockCountIndex = 2;
   static const int kSlotIndexCount = 3;
 
+ private:
+  static int FirstIndexForSlot(int slot_index) {
+    return kFirstSlotIndex + slot_index * kSlotIndexCount;
+  }
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(CoverageInfo);
 };
 
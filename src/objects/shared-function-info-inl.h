@@ -205,7 +205,8 @@ Code* SharedFunctionInfo::code() const {
 void SharedFunctionInfo::set_code(Code* value, WriteBarrierMode mode) {
   DCHECK(value->kind() != Code::OPTIMIZED_FUNCTION);
   // If the SharedFunctionInfo has bytecode we should never mark it for lazy
-  // compile, since the bytecode is never flushed.
+  // compile; bytecode flushing clears the bytecode array before falling back
+  // to the lazy compile builtin.
   DCHECK(value != GetIsolate()->builtins()->builtin(Builtins::kCompileLazy) ||
          !HasBytecodeArray());
   WRITE_FIELD(this, kCodeOffset, value);
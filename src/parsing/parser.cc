@@ -30,7 +30,11 @@ namespace v8 {
 namespace internal {
 
 ScriptData::ScriptData(const byte* data, int length)
-    : owns_data_(false), rejected_(false), data_(data), length_(length) {
+    : owns_data_(false),
+      rejected_(false),
+      background_checked_(false),
+      data_(data),
+      length_(length) {
   if (!IsAligned(reinterpret_cast<intptr_t>(data), kPointerAlignment)) {
     byte* copy = NewArray<byte>(length);
     DCHECK(IsAligned(reinterpret_cast<intptr_t>(copy), kPointerAlignment));
@@ -42,8 +46,10 @@ ScriptData::ScriptData(const byte* data, int length)
 
 FunctionEntry ParseData::GetFunctionEntry(int start) {
   // The current pre-data entry must be a FunctionEntry with the given
-  // start position.
-  if ((function_index_ + FunctionEntry::kSize <= Length()) &&
+  // start position. Note that the function entry section is followed by the
+  // preparsed scope data section, so Length() is not the right bound here.
+  int functions_end = PreparseDataConstants::kHeaderSize + FunctionsSize();
+  if ((function_index_ + FunctionEntry::kSize <= functions_end) &&
       (static_cast<int>(Data()[function_index_]) == start)) {
     int index = function_index_;
     function_index_ += FunctionEntry::kSize;
@@ -61,6 +67,22 @@ int ParseData::FunctionCount() {
   return functions_size / FunctionEntry::kSize;
 }
 
+Vector<const uint8_t> ParseData::GetPreParsedScopeData(
+    const FunctionEntry& entry) {
+  int length = entry.preparsed_scope_data_length();
+  if (length <= 0) return Vector<const uint8_t>();
+  int offset = entry.preparsed_scope_data_offset();
+  int section_start = static_cast<int>(
+      (PreparseDataConstants::kHeaderSize + FunctionsSize()) *
+      sizeof(unsigned));
+  if (offset < 0 || offset > PreParsedScopeDataSize() - length) {
+    return Vector<const uint8_t>();
+  }
+  DCHECK_LE(section_start + offset + length, script_data_->length());
+  return Vector<const uint8_t>(script_data_->data() + section_start + offset,
+                               length);
+}
+
 
 bool ParseData::IsSane() {
   if (!IsAligned(script_data_->length(), sizeof(unsigned))) return false;
@@ -74,9 +96,15 @@ bool ParseData::IsSane() {
   int functions_size = FunctionsSize();
   if (functions_size < 0) return false;
   if (functions_size % FunctionEntry::kSize != 0) return false;
-  // Check that the total size has room for header and function entries.
-  int minimum_size =
-      PreparseDataConstants::kHeaderSize + functions_size;
+  // Check that the space allocated for the preparsed scope data is sane.
+  int scope_data_size = PreParsedScopeDataSize();
+  if (scope_data_size < 0) return false;
+  int scope_data_words = static_cast<int>(
+      (scope_data_size + sizeof(unsigned) - 1) / sizeof(unsigned));
+  // Check that the total size has room for header, function entries and
+  // preparsed scope data.
+  int minimum_size = PreparseDataConstants::kHeaderSize + functions_size +
+                     scope_data_words;
   if (data_length < minimum_size) return false;
   return true;
 }
@@ -105,6 +133,11 @@ int ParseData::FunctionsSize() {
   return static_cast<int>(Data()[PreparseDataConstants::kFunctionsSizeOffset]);
 }
 
+int ParseData::PreParsedScopeDataSize() {
+  return static_cast<int>(
+      Data()[PreparseDataConstants::kPreParsedScopeDataSizeOffset]);
+}
+
 // Helper for putting parts of the parse results into a temporary zone when
 // parsing inner function bodies.
 class DiscardableZoneScope {
@@ -2779,6 +2812,18 @@ Parser::LazyParsingResult Parser::SkipFunction(
       SetLanguageMode(function_scope, entry.language_mode());
       if (entry.uses_super_property())
         function_scope->RecordSuperPropertyUsage();
+      if (FLAG_preparser_scope_analysis) {
+        // If the cached data also contains the preparsed scope data for this
+        // function, attach it to the literal, so that the inner functions can
+        // be skipped when the function is compiled later.
+        Vector<const uint8_t> scope_data =
+            cached_parse_data_->GetPreParsedScopeData(entry);
+        if (!scope_data.is_empty()) {
+          *produced_preparsed_scope_data = new (main_zone())
+              ProducedPreParsedScopeData(scope_data, main_zone());
+          function_scope->set_is_skipped_function(true);
+        }
+      }
       SkipFunctionLiterals(entry.num_inner_functions());
       return kLazyParsingComplete;
     }
@@ -2848,7 +2893,8 @@ Parser::LazyParsingResult Parser::SkipFunction(
     log_->LogFunction(function_scope->start_position(),
                       function_scope->end_position(), *num_parameters,
                       language_mode(), function_scope->NeedsHomeObject(),
-                      logger->num_inner_functions());
+                      logger->num_inner_functions(),
+                      *produced_preparsed_scope_data);
   }
   return kLazyParsingComplete;
 }
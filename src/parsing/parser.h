@@ -41,6 +41,8 @@ class FunctionEntry BASE_EMBEDDED {
     kNumParametersIndex,
     kFlagsIndex,
     kNumInnerFunctionsIndex,
+    kPreParsedScopeDataOffsetIndex,
+    kPreParsedScopeDataLengthIndex,
     kSize
   };
 
@@ -69,6 +71,15 @@ class FunctionEntry BASE_EMBEDDED {
     return UsesSuperPropertyField::decode(backing_[kFlagsIndex]);
   }
   int num_inner_functions() const { return backing_[kNumInnerFunctionsIndex]; }
+  // Offset and length (in bytes) of the serialized preparsed scope data for
+  // this function within the preparsed scope data section; a length of zero
+  // means no data was cached.
+  int preparsed_scope_data_offset() const {
+    return backing_[kPreParsedScopeDataOffsetIndex];
+  }
+  int preparsed_scope_data_length() const {
+    return backing_[kPreParsedScopeDataLengthIndex];
+  }
 
   bool is_valid() const { return !backing_.is_empty(); }
 
@@ -92,6 +103,11 @@ class ParseData {
   FunctionEntry GetFunctionEntry(int start);
   int FunctionCount();
 
+  // Returns the serialized preparsed scope data for the given function entry,
+  // or an empty vector if no data was cached for it (or if the data is
+  // malformed).
+  Vector<const uint8_t> GetPreParsedScopeData(const FunctionEntry& entry);
+
   unsigned* Data() {  // Writable data as unsigned int array.
     return reinterpret_cast<unsigned*>(const_cast<byte*>(script_data_->data()));
   }
@@ -107,6 +123,7 @@ class ParseData {
   unsigned Magic();
   unsigned Version();
   int FunctionsSize();
+  int PreParsedScopeDataSize();
   int Length() const {
     // Script data length is already checked to be a multiple of unsigned size.
     return script_data_->length() / sizeof(unsigned);
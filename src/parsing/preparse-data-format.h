@@ -14,12 +14,20 @@ struct PreparseDataConstants {
  public:
   // Layout and constants of the preparse data exchange format.
   static const unsigned kMagicNumber = 0xBadDead;
-  static const unsigned kCurrentVersion = 17;
+  // The preparsed scope data layout differs between debug and release builds;
+  // mark debug-produced data so that the other build flavor rejects it.
+#ifdef DEBUG
+  static const unsigned kCurrentVersion = 18 | 0x80000000u;
+#else
+  static const unsigned kCurrentVersion = 18;
+#endif
 
   static const int kMagicOffset = 0;
   static const int kVersionOffset = 1;
   static const int kFunctionsSizeOffset = 2;
-  static const int kSizeOffset = 3;
+  // Size in bytes of the preparsed scope data section, which follows the
+  // function entries.
+  static const int kPreParsedScopeDataSizeOffset = 3;
   static const int kHeaderSize = 4;
 
   static const unsigned char kNumberTerminator = 0x80u;
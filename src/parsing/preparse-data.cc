@@ -9,20 +9,26 @@
 #include "src/objects-inl.h"
 #include "src/parsing/parser.h"
 #include "src/parsing/preparse-data-format.h"
+#include "src/parsing/preparsed-scope-data.h"
 
 namespace v8 {
 namespace internal {
 
-void ParserLogger::LogFunction(int start, int end, int num_parameters,
-                               LanguageMode language_mode,
-                               bool uses_super_property,
-                               int num_inner_functions) {
+void ParserLogger::LogFunction(
+    int start, int end, int num_parameters, LanguageMode language_mode,
+    bool uses_super_property, int num_inner_functions,
+    ProducedPreParsedScopeData* preparsed_scope_data) {
   function_store_.Add(start);
   function_store_.Add(end);
   function_store_.Add(num_parameters);
   function_store_.Add(
       FunctionEntry::EncodeFlags(language_mode, uses_super_property));
   function_store_.Add(num_inner_functions);
+  // Offset and length of the preparsed scope data; overwritten in
+  // GetScriptData once the data has been serialized.
+  function_store_.Add(0);
+  function_store_.Add(0);
+  preparsed_scope_data_.push_back(preparsed_scope_data);
 }
 
 ParserLogger::ParserLogger() {
@@ -31,7 +37,7 @@ ParserLogger::ParserLogger() {
   preamble_[PreparseDataConstants::kVersionOffset] =
       PreparseDataConstants::kCurrentVersion;
   preamble_[PreparseDataConstants::kFunctionsSizeOffset] = 0;
-  preamble_[PreparseDataConstants::kSizeOffset] = 0;
+  preamble_[PreparseDataConstants::kPreParsedScopeDataSizeOffset] = 0;
   DCHECK_EQ(4, PreparseDataConstants::kHeaderSize);
 #ifdef DEBUG
   prev_start_ = -1;
@@ -40,13 +46,55 @@ ParserLogger::ParserLogger() {
 
 ScriptData* ParserLogger::GetScriptData() {
   int function_size = function_store_.size();
-  int total_size = PreparseDataConstants::kHeaderSize + function_size;
+  DCHECK_EQ(function_size % FunctionEntry::kSize, 0);
+  DCHECK_EQ(static_cast<size_t>(function_size / FunctionEntry::kSize),
+            preparsed_scope_data_.size());
+
+  // Serialize the preparsed scope data gathered for each function. By now all
+  // functions have been fully parsed, so the scope allocation data is
+  // complete.
+  std::vector<uint8_t> scope_data;
+  std::vector<std::pair<unsigned, unsigned>> scope_data_spans;
+  scope_data_spans.reserve(preparsed_scope_data_.size());
+  for (ProducedPreParsedScopeData* produced : preparsed_scope_data_) {
+    unsigned offset = static_cast<unsigned>(scope_data.size());
+    if (produced != nullptr && produced->HasDataForParserCache()) {
+      produced->SerializeForParserCache(&scope_data);
+    }
+    scope_data_spans.push_back(std::make_pair(
+        offset, static_cast<unsigned>(scope_data.size()) - offset));
+  }
+  int scope_data_size = static_cast<int>(scope_data.size());
+  int scope_data_words = static_cast<int>(
+      (scope_data_size + sizeof(unsigned) - 1) / sizeof(unsigned));
+
+  int total_size =
+      PreparseDataConstants::kHeaderSize + function_size + scope_data_words;
   unsigned* data = NewArray<unsigned>(total_size);
   preamble_[PreparseDataConstants::kFunctionsSizeOffset] = function_size;
+  preamble_[PreparseDataConstants::kPreParsedScopeDataSizeOffset] =
+      scope_data_size;
   MemCopy(data, preamble_, sizeof(preamble_));
   if (function_size > 0) {
     function_store_.WriteTo(Vector<unsigned>(
         data + PreparseDataConstants::kHeaderSize, function_size));
+    // Fill in the offsets and lengths of the preparsed scope data, which were
+    // not yet known when the entries were logged.
+    for (size_t i = 0; i < scope_data_spans.size(); ++i) {
+      unsigned* entry = data + PreparseDataConstants::kHeaderSize +
+                        static_cast<int>(i) * FunctionEntry::kSize;
+      entry[FunctionEntry::kPreParsedScopeDataOffsetIndex] =
+          scope_data_spans[i].first;
+      entry[FunctionEntry::kPreParsedScopeDataLengthIndex] =
+          scope_data_spans[i].second;
+    }
+  }
+  if (scope_data_size > 0) {
+    // Zero the padding in the last word so that the cached data is
+    // deterministic.
+    data[total_size - 1] = 0;
+    MemCopy(data + PreparseDataConstants::kHeaderSize + function_size,
+            scope_data.data(), scope_data_size);
   }
   DCHECK(IsAligned(reinterpret_cast<intptr_t>(data), kPointerAlignment));
   ScriptData* result = new ScriptData(reinterpret_cast<byte*>(data),
@@ -6,6 +6,7 @@
 #define V8_PARSING_PREPARSE_DATA_H_
 
 #include <unordered_map>
+#include <vector>
 
 #include "src/allocation.h"
 #include "src/base/hashmap.h"
@@ -16,6 +17,8 @@
 namespace v8 {
 namespace internal {
 
+class ProducedPreParsedScopeData;
+
 class ScriptData {
  public:
   ScriptData(const byte* data, int length);
@@ -29,6 +32,11 @@ class ScriptData {
 
   void Reject() { rejected_ = true; }
 
+  // Whether a background CodeCacheConsumptionTask has already validated the
+  // source-independent parts of this data (see SerializedCodeData).
+  bool background_checked() const { return background_checked_; }
+  void set_background_checked() { background_checked_ = true; }
+
   void AcquireDataOwnership() {
     DCHECK(!owns_data_);
     owns_data_ = true;
@@ -42,6 +50,7 @@ class ScriptData {
  private:
   bool owns_data_ : 1;
   bool rejected_ : 1;
+  bool background_checked_ : 1;
   const byte* data_;
   int length_;
 
@@ -78,14 +87,20 @@ class ParserLogger final {
  public:
   ParserLogger();
 
+  // preparsed_scope_data may be null. It is not serialized here but in
+  // GetScriptData, since the scope allocation data is attached to it only
+  // when the enclosing function has been fully parsed (see
+  // DeclarationScope::AnalyzePartially).
   void LogFunction(int start, int end, int num_parameters,
                    LanguageMode language_mode, bool uses_super_property,
-                   int num_inner_functions);
+                   int num_inner_functions,
+                   ProducedPreParsedScopeData* preparsed_scope_data);
 
   ScriptData* GetScriptData();
 
  private:
   Collector<unsigned> function_store_;
+  std::vector<ProducedPreParsedScopeData*> preparsed_scope_data_;
   unsigned preamble_[PreparseDataConstants::kHeaderSize];
 
 #ifdef DEBUG
@@ -10,6 +10,7 @@
 #include "src/objects-inl.h"
 #include "src/objects/shared-function-info.h"
 #include "src/parsing/preparser.h"
+#include "src/utils.h"
 
 namespace v8 {
 namespace internal {
@@ -42,6 +43,27 @@ class LanguageField : public BitField8<LanguageMode, 0, 1> {};
 class UsesSuperField : public BitField8<bool, LanguageField::kNext, 1> {};
 STATIC_ASSERT(LanguageModeSize <= LanguageField::kNumValues);
 
+// Helpers for the flat byte format used by the parser cache (see
+// SerializeForParserCache).
+void WriteCachedUint32(std::vector<uint8_t>* out, uint32_t value) {
+  const uint8_t* d = reinterpret_cast<uint8_t*>(&value);
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    out->push_back(*d++);
+  }
+}
+
+bool ReadCachedUint32(Vector<const uint8_t> data, int* position,
+                      uint32_t* value) {
+  if (data.length() - *position < static_cast<int>(sizeof(*value))) {
+    return false;
+  }
+  uint8_t* d = reinterpret_cast<uint8_t*>(value);
+  for (size_t i = 0; i < sizeof(*value); ++i) {
+    *d++ = data[(*position)++];
+  }
+  return true;
+}
+
 }  // namespace
 
 /*
@@ -157,6 +179,11 @@ Handle<PodArray<uint8_t>> ProducedPreParsedScopeData::ByteData::Serialize(
   return array;
 }
 
+void ProducedPreParsedScopeData::ByteData::CopyTo(
+    std::vector<uint8_t>* out) const {
+  out->insert(out->end(), backing_store_.begin(), backing_store_.end());
+}
+
 ProducedPreParsedScopeData::ProducedPreParsedScopeData(
     Zone* zone, ProducedPreParsedScopeData* parent)
     : parent_(parent),
@@ -180,6 +207,22 @@ ProducedPreParsedScopeData::ProducedPreParsedScopeData(
       bailed_out_(false),
       previously_produced_preparsed_scope_data_(data) {}
 
+// Create a ProducedPreParsedScopeData which wraps serialized data from a
+// parser cache.
+ProducedPreParsedScopeData::ProducedPreParsedScopeData(
+    Vector<const uint8_t> cached_data, Zone* zone)
+    : parent_(nullptr),
+      byte_data_(nullptr),
+      data_for_inner_functions_(zone),
+      bailed_out_(false) {
+  DCHECK(!cached_data.is_empty());
+  // Copy the data into the zone; the cached data is owned by the embedder and
+  // may not outlive the compilation.
+  uint8_t* copy = zone->NewArray<uint8_t>(cached_data.length());
+  MemCopy(copy, cached_data.start(), cached_data.length());
+  cached_data_ = Vector<const uint8_t>(copy, cached_data.length());
+}
+
 ProducedPreParsedScopeData::DataGatheringScope::DataGatheringScope(
     DeclarationScope* function_scope, PreParser* preparser)
     : function_scope_(function_scope),
@@ -281,6 +324,11 @@ MaybeHandle<PreParsedScopeData> ProducedPreParsedScopeData::Serialize(
     DCHECK_EQ(data_for_inner_functions_.size(), 0);
     return previously_produced_preparsed_scope_data_;
   }
+  if (!cached_data_.is_empty()) {
+    DCHECK(!bailed_out_);
+    DCHECK_EQ(data_for_inner_functions_.size(), 0);
+    return DeserializeFromParserCache(isolate, cached_data_);
+  }
   if (bailed_out_) {
     return MaybeHandle<PreParsedScopeData>();
   }
@@ -321,6 +369,119 @@ MaybeHandle<PreParsedScopeData> ProducedPreParsedScopeData::Serialize(
   return data;
 }
 
+bool ProducedPreParsedScopeData::HasDataForParserCache() const {
+  // Parser cache production never consumes previously produced data, so this
+  // is always directly produced data.
+  DCHECK(previously_produced_preparsed_scope_data_.is_null());
+  DCHECK(cached_data_.is_empty());
+  return !bailed_out_ && byte_data_->size() > kPlaceholderSize;
+}
+
+void ProducedPreParsedScopeData::SerializeForParserCache(
+    std::vector<uint8_t>* out) const {
+  DCHECK(HasDataForParserCache());
+
+  DCHECK_LE(byte_data_->size(), std::numeric_limits<uint32_t>::max());
+  WriteCachedUint32(out, static_cast<uint32_t>(byte_data_->size()));
+  byte_data_->CopyTo(out);
+
+  DCHECK_LE(data_for_inner_functions_.size(),
+            std::numeric_limits<uint32_t>::max());
+  WriteCachedUint32(out,
+                    static_cast<uint32_t>(data_for_inner_functions_.size()));
+  for (const auto& item : data_for_inner_functions_) {
+    if (item->HasDataForParserCache()) {
+      out->push_back(1);
+      item->SerializeForParserCache(out);
+    } else {
+      // The child function bailed out or contains no skippable functions.
+      out->push_back(0);
+    }
+  }
+}
+
+namespace {
+
+MaybeHandle<PreParsedScopeData> DeserializeCachedData(
+    Isolate* isolate, Vector<const uint8_t> data, int* position) {
+  uint32_t scope_data_length;
+  if (!ReadCachedUint32(data, position, &scope_data_length)) {
+    return MaybeHandle<PreParsedScopeData>();
+  }
+  if (scope_data_length <= static_cast<uint32_t>(kPlaceholderSize) ||
+      scope_data_length > static_cast<uint32_t>(data.length() - *position)) {
+    return MaybeHandle<PreParsedScopeData>();
+  }
+  Handle<PodArray<uint8_t>> scope_data = PodArray<uint8_t>::New(
+      isolate, static_cast<int>(scope_data_length), TENURED);
+  {
+    DisallowHeapAllocation no_gc;
+    PodArray<uint8_t>* raw_array = *scope_data;
+    for (uint32_t i = 0; i < scope_data_length; ++i) {
+      raw_array->set(i, data[*position + i]);
+    }
+  }
+  *position += scope_data_length;
+
+  uint32_t num_children;
+  if (!ReadCachedUint32(data, position, &num_children)) {
+    return MaybeHandle<PreParsedScopeData>();
+  }
+  // Each child takes up at least its one-byte marker.
+  if (num_children > static_cast<uint32_t>(data.length() - *position)) {
+    return MaybeHandle<PreParsedScopeData>();
+  }
+
+  Handle<PreParsedScopeData> result =
+      isolate->factory()->NewPreParsedScopeData();
+  result->set_scope_data(*scope_data);
+
+  if (num_children == 0) {
+    result->set_child_data(*(isolate->factory()->empty_fixed_array()));
+    return result;
+  }
+  Handle<FixedArray> child_array = isolate->factory()->NewFixedArray(
+      static_cast<int>(num_children), TENURED);
+  for (uint32_t i = 0; i < num_children; ++i) {
+    DCHECK_LE(*position, data.length());
+    if (*position == data.length()) {
+      return MaybeHandle<PreParsedScopeData>();
+    }
+    uint8_t marker = data[(*position)++];
+    if (marker == 0) {
+      child_array->set(i, *(isolate->factory()->null_value()));
+    } else if (marker == 1) {
+      Handle<PreParsedScopeData> child;
+      if (!DeserializeCachedData(isolate, data, position).ToHandle(&child)) {
+        return MaybeHandle<PreParsedScopeData>();
+      }
+      child_array->set(i, *child);
+    } else {
+      return MaybeHandle<PreParsedScopeData>();
+    }
+  }
+  result->set_child_data(*child_array);
+  return result;
+}
+
+}  // namespace
+
+// static
+MaybeHandle<PreParsedScopeData>
+ProducedPreParsedScopeData::DeserializeFromParserCache(
+    Isolate* isolate, Vector<const uint8_t> data) {
+  int position = 0;
+  Handle<PreParsedScopeData> result;
+  if (!DeserializeCachedData(isolate, data, &position).ToHandle(&result)) {
+    return MaybeHandle<PreParsedScopeData>();
+  }
+  // Reject trailing garbage.
+  if (position != data.length()) {
+    return MaybeHandle<PreParsedScopeData>();
+  }
+  return result;
+}
+
 bool ProducedPreParsedScopeData::ScopeNeedsData(Scope* scope) {
   if (scope->scope_type() == ScopeType::FUNCTION_SCOPE) {
     // Default constructors don't need data (they cannot contain inner functions
@@ -81,6 +81,9 @@ class ProducedPreParsedScopeData : public ZoneObject {
 
     Handle<PodArray<uint8_t>> Serialize(Isolate* isolate) const;
 
+    // Appends the raw data to out (for the parser cache).
+    void CopyTo(std::vector<uint8_t>* out) const;
+
     size_t size() const { return backing_store_.size(); }
 
    private:
@@ -96,6 +99,11 @@ class ProducedPreParsedScopeData : public ZoneObject {
   // produced PreParsedScopeData.
   ProducedPreParsedScopeData(Handle<PreParsedScopeData> data, Zone* zone);
 
+  // Create a ProducedPreParsedScopeData wrapping serialized data from a
+  // parser cache (see SerializeForParserCache). The data is copied into the
+  // zone and only turned into heap objects when Serialize is called.
+  ProducedPreParsedScopeData(Vector<const uint8_t> cached_data, Zone* zone);
+
   ProducedPreParsedScopeData* parent() const { return parent_; }
 
   // For gathering the inner function data and splitting it up according to the
@@ -152,6 +160,21 @@ class ProducedPreParsedScopeData : public ZoneObject {
   // MaybeHandle.
   MaybeHandle<PreParsedScopeData> Serialize(Isolate* isolate) const;
 
+  // Returns true if SerializeForParserCache would produce data. Only valid
+  // for directly produced data (not for proxies of previously produced data).
+  bool HasDataForParserCache() const;
+
+  // Writes the data (including the data for inner functions) into a flat
+  // byte stream which is independent of the heap, for inclusion in a parser
+  // cache (see ParserLogger).
+  void SerializeForParserCache(std::vector<uint8_t>* out) const;
+
+  // The counterpart of SerializeForParserCache; rebuilds the heap objects
+  // from the byte stream. Returns a null MaybeHandle if the data is
+  // malformed.
+  static MaybeHandle<PreParsedScopeData> DeserializeFromParserCache(
+      Isolate* isolate, Vector<const uint8_t> data);
+
   static bool ScopeNeedsData(Scope* scope);
   static bool ScopeIsSkippableFunctionScope(Scope* scope);
 
@@ -177,6 +200,10 @@ class ProducedPreParsedScopeData : public ZoneObject {
   // which was produced already earlier. This happens for deeper lazy functions.
   Handle<PreParsedScopeData> previously_produced_preparsed_scope_data_;
 
+  // ... or serialized data from a parser cache, deserialized lazily by
+  // Serialize.
+  Vector<const uint8_t> cached_data_;
+
   DISALLOW_COPY_AND_ASSIGN(ProducedPreParsedScopeData);
 };
 
@@ -193,22 +193,24 @@ size_t ExternalOneByteStringUtf16CharacterStream::FillBuffer(size_t from_pos) {
 // ----------------------------------------------------------------------------
 // Utf8ExternalStreamingStream - chunked streaming of Utf-8 data.
 //
-// This implementation is fairly complex, since data arrives in chunks which
-// may 'cut' arbitrarily into utf-8 characters. Also, seeking to a given
-// character position is tricky because the byte position cannot be dericed
-// from the character position.
+// Data arrives in chunks which may 'cut' arbitrarily into utf-8 characters,
+// and the byte position of a character cannot be derived from its character
+// position. We therefore decode each chunk to ucs-2 exactly once, when it
+// arrives, carrying incomplete trailing characters over into the next chunk.
+// Seeking and refilling the buffer then reduce to index arithmetic on the
+// decoded data; no byte is ever decoded twice.
 
 class Utf8ExternalStreamingStream : public BufferedUtf16CharacterStream {
  public:
   Utf8ExternalStreamingStream(
       ScriptCompiler::ExternalSourceStream* source_stream,
       RuntimeCallStats* stats)
-      : current_({0, {0, 0, unibrow::Utf8::Utf8IncrementalBuffer(0)}}),
+      : incomplete_char_(0),
+        stream_bytes_(0),
+        stream_chars_(0),
+        eof_(false),
         source_stream_(source_stream),
         stats_(stats) {}
-  ~Utf8ExternalStreamingStream() override {
-    for (size_t i = 0; i < chunks_.size(); i++) delete[] chunks_[i].data;
-  }
 
   bool can_access_heap() override { return false; }
 
@@ -216,252 +218,108 @@ class Utf8ExternalStreamingStream : public BufferedUtf16CharacterStream {
   size_t FillBuffer(size_t position) override;
 
  private:
-  // A position within the data stream. It stores:
-  // - The 'physical' position (# of bytes in the stream),
-  // - the 'logical' position (# of ucs-2 characters, also within the stream),
-  // - a possibly incomplete utf-8 char at the current 'physical' position.
-  struct StreamPosition {
-    size_t bytes;
-    size_t chars;
-    unibrow::Utf8::Utf8IncrementalBuffer incomplete_char;
-  };
-
-  // Position contains a StreamPosition and the index of the chunk the position
-  // points into. (The chunk_no could be derived from pos, but that'd be
-  // an expensive search through all chunks.)
-  struct Position {
-    size_t chunk_no;
-    StreamPosition pos;
+  // A chunk of the stream, decoded to ucs-2 when it arrived. |start_char| is
+  // the stream position of the first decoded character. Chunks that decode
+  // to no characters (e.g. a chunk that cuts into the middle of a single
+  // utf-8 character) are not stored.
+  struct DecodedChunk {
+    std::vector<uc16> data;
+    size_t start_char;
   };
 
-  // A chunk in the list of chunks, containing:
-  // - The chunk data (data pointer and length), and
-  // - the position at the first byte of the chunk.
-  struct Chunk {
-    const uint8_t* data;
-    size_t length;
-    StreamPosition start;
-  };
-
-  // Within the current chunk, skip forward from current_ towards position.
-  bool SkipToPosition(size_t position);
-  // Within the current chunk, fill the buffer_ (while it has capacity).
-  void FillBufferFromCurrentChunk();
-  // Fetch a new chunk (assuming current_ is at the end of the current data).
-  bool FetchChunk();
-  // Search through the chunks and set current_ to point to the given position.
-  // (This call is potentially expensive.)
-  void SearchPosition(size_t position);
-
-  std::vector<Chunk> chunks_;
-  Position current_;
+  // Fetches one more chunk from the embedder and decodes it, including any
+  // utf-8 sequence that was cut by the previous chunk boundary. Returns
+  // false if the stream is exhausted.
+  bool FetchAndDecodeChunk();
+
+  std::vector<DecodedChunk> chunks_;
+  // Decoder state for a utf-8 sequence cut by a chunk boundary.
+  unibrow::Utf8::Utf8IncrementalBuffer incomplete_char_;
+  size_t stream_bytes_;  // Total bytes received so far.
+  size_t stream_chars_;  // Total characters decoded so far.
+  bool eof_;
   ScriptCompiler::ExternalSourceStream* source_stream_;
   RuntimeCallStats* stats_;
 };
 
-bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
-  DCHECK_LE(current_.pos.chars, position);  // We can only skip forward.
-
-  // Already there? Then return immediately.
-  if (current_.pos.chars == position) return true;
-
-  const Chunk& chunk = chunks_[current_.chunk_no];
-  DCHECK(current_.pos.bytes >= chunk.start.bytes);
-
-  unibrow::Utf8::Utf8IncrementalBuffer incomplete_char =
-      chunk.start.incomplete_char;
-  size_t it = current_.pos.bytes - chunk.start.bytes;
-  size_t chars = chunk.start.chars;
-  while (it < chunk.length && chars < position) {
-    unibrow::uchar t =
-        unibrow::Utf8::ValueOfIncremental(chunk.data[it], &incomplete_char);
-    if (t == kUtf8Bom && current_.pos.chars == 0) {
-      // BOM detected at beginning of the stream. Don't copy it.
-    } else if (t != unibrow::Utf8::kIncomplete) {
-      chars++;
-      if (t > unibrow::Utf16::kMaxNonSurrogateCharCode) chars++;
-    }
-    it++;
+bool Utf8ExternalStreamingStream::FetchAndDecodeChunk() {
+  DCHECK(!eof_);
+  const uint8_t* data = nullptr;
+  size_t length;
+  {
+    RuntimeCallTimerScope scope(stats_,
+                                &RuntimeCallStats::GetMoreDataCallback);
+    length = source_stream_->GetMoreData(&data);
   }
 
-  current_.pos.bytes += it;
-  current_.pos.chars = chars;
-  current_.pos.incomplete_char = incomplete_char;
-  current_.chunk_no += (it == chunk.length);
-
-  return current_.pos.chars == position;
-}
-
-void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
-  DCHECK_LT(current_.chunk_no, chunks_.size());
-  DCHECK_EQ(buffer_start_, buffer_cursor_);
-  DCHECK_LT(buffer_end_ + 1, buffer_start_ + kBufferSize);
-
-  const Chunk& chunk = chunks_[current_.chunk_no];
-
-  // The buffer_ is writable, but buffer_*_ members are const. So we get a
-  // non-const pointer into buffer that points to the same char as buffer_end_.
-  uint16_t* cursor = buffer_ + (buffer_end_ - buffer_start_);
-  DCHECK_EQ(cursor, buffer_end_);
-
-  // If the current chunk is the last (empty) chunk we'll have to process
-  // any left-over, partial characters.
-  if (chunk.length == 0) {
+  if (length == 0) {
+    // End of stream. A partial character at the end of the data is decoded
+    // as if the sequence had been truncated here.
+    eof_ = true;
     unibrow::uchar t =
-        unibrow::Utf8::ValueOfIncrementalFinish(&current_.pos.incomplete_char);
+        unibrow::Utf8::ValueOfIncrementalFinish(&incomplete_char_);
     if (t != unibrow::Utf8::kBufferEmpty) {
       DCHECK_LT(t, unibrow::Utf16::kMaxNonSurrogateCharCode);
-      *cursor = static_cast<uc16>(t);
-      buffer_end_++;
-      current_.pos.chars++;
+      chunks_.push_back({{static_cast<uc16>(t)}, stream_chars_});
+      stream_chars_++;
     }
-    return;
+    delete[] data;
+    return false;
   }
 
-  unibrow::Utf8::Utf8IncrementalBuffer incomplete_char =
-      current_.pos.incomplete_char;
-  size_t it;
-  for (it = current_.pos.bytes - chunk.start.bytes;
-       it < chunk.length && cursor + 1 < buffer_start_ + kBufferSize; it++) {
+  DecodedChunk chunk;
+  chunk.start_char = stream_chars_;
+  chunk.data.reserve(length);
+  for (size_t i = 0; i < length; i++) {
     unibrow::uchar t =
-        unibrow::Utf8::ValueOfIncremental(chunk.data[it], &incomplete_char);
+        unibrow::Utf8::ValueOfIncremental(data[i], &incomplete_char_);
     if (t == unibrow::Utf8::kIncomplete) continue;
     if (V8_LIKELY(t < kUtf8Bom)) {
-      *(cursor++) = static_cast<uc16>(t);  // The by most frequent case.
-    } else if (t == kUtf8Bom && current_.pos.bytes + it == 2) {
+      chunk.data.push_back(static_cast<uc16>(t));  // The most frequent case.
+    } else if (t == kUtf8Bom && stream_bytes_ + i == 2) {
       // BOM detected at beginning of the stream. Don't copy it.
     } else if (t <= unibrow::Utf16::kMaxNonSurrogateCharCode) {
-      *(cursor++) = static_cast<uc16>(t);
+      chunk.data.push_back(static_cast<uc16>(t));
     } else {
-      *(cursor++) = unibrow::Utf16::LeadSurrogate(t);
-      *(cursor++) = unibrow::Utf16::TrailSurrogate(t);
+      chunk.data.push_back(unibrow::Utf16::LeadSurrogate(t));
+      chunk.data.push_back(unibrow::Utf16::TrailSurrogate(t));
     }
   }
+  stream_bytes_ += length;
+  delete[] data;
 
-  current_.pos.bytes = chunk.start.bytes + it;
-  current_.pos.chars += (cursor - buffer_end_);
-  current_.pos.incomplete_char = incomplete_char;
-  current_.chunk_no += (it == chunk.length);
-
-  buffer_end_ = cursor;
-}
-
-bool Utf8ExternalStreamingStream::FetchChunk() {
-  RuntimeCallTimerScope scope(stats_, &RuntimeCallStats::GetMoreDataCallback);
-  DCHECK_EQ(current_.chunk_no, chunks_.size());
-  DCHECK(chunks_.empty() || chunks_.back().length != 0);
-
-  const uint8_t* chunk = nullptr;
-  size_t length = source_stream_->GetMoreData(&chunk);
-  chunks_.push_back({chunk, length, current_.pos});
-  return length > 0;
+  if (!chunk.data.empty()) {
+    stream_chars_ += chunk.data.size();
+    chunks_.push_back(std::move(chunk));
+  }
+  return true;
 }
 
-void Utf8ExternalStreamingStream::SearchPosition(size_t position) {
-  // If current_ already points to the right position, we're done.
-  //
-  // This is expected to be the common case, since we typically call
-  // FillBuffer right after the current buffer.
-  if (current_.pos.chars == position) return;
-
-  // No chunks. Fetch at least one, so we can assume !chunks_.empty() below.
-  if (chunks_.empty()) {
-    DCHECK_EQ(current_.chunk_no, 0u);
-    DCHECK_EQ(current_.pos.bytes, 0u);
-    DCHECK_EQ(current_.pos.chars, 0u);
-    FetchChunk();
+size_t Utf8ExternalStreamingStream::FillBuffer(size_t position) {
+  // Fetch and decode chunks until the position is covered. (The embedder
+  // might give us 1-byte chunks within a utf-8 char, so one chunk does not
+  // guarantee progress. Thus we iterate.)
+  while (!eof_ && position >= stream_chars_) {
+    FetchAndDecodeChunk();
   }
+  if (position >= stream_chars_) return 0;
 
-  // Search for the last chunk whose start position is less or equal to
-  // position.
+  // Find the chunk containing position. We almost always 'stream', meaning
+  // we want data from the last chunk, so look at chunks back-to-front. Note
+  // that surrogate pairs never straddle chunks: both code units are decoded
+  // into the chunk in which the character was completed.
   size_t chunk_no = chunks_.size() - 1;
-  while (chunk_no > 0 && chunks_[chunk_no].start.chars > position) {
+  while (chunks_[chunk_no].start_char > position) {
+    DCHECK_NE(chunk_no, 0u);
     chunk_no--;
   }
+  const DecodedChunk& chunk = chunks_[chunk_no];
+  DCHECK_LT(position, chunk.start_char + chunk.data.size());
 
-  // Did we find the terminating (zero-length) chunk? Then we're seeking
-  // behind the end of the data, and position does not exist.
-  // Set current_ to point to the terminating chunk.
-  if (chunks_[chunk_no].length == 0) {
-    current_ = {chunk_no, chunks_[chunk_no].start};
-    return;
-  }
-
-  // Did we find the non-last chunk? Then our position must be within chunk_no.
-  if (chunk_no + 1 < chunks_.size()) {
-    // Fancy-pants optimization for ASCII chunks within a utf-8 stream.
-    // (Many web sites declare utf-8 encoding, but use only (or almost only) the
-    //  ASCII subset for their JavaScript sources. We can exploit this, by
-    //  checking whether the # bytes in a chunk are equal to the # chars, and if
-    //  so avoid the expensive SkipToPosition.)
-    bool ascii_only_chunk =
-        chunks_[chunk_no].start.incomplete_char ==
-            unibrow::Utf8::Utf8IncrementalBuffer(0) &&
-        (chunks_[chunk_no + 1].start.bytes - chunks_[chunk_no].start.bytes) ==
-            (chunks_[chunk_no + 1].start.chars - chunks_[chunk_no].start.chars);
-    if (ascii_only_chunk) {
-      size_t skip = position - chunks_[chunk_no].start.chars;
-      current_ = {chunk_no,
-                  {chunks_[chunk_no].start.bytes + skip,
-                   chunks_[chunk_no].start.chars + skip,
-                   unibrow::Utf8::Utf8IncrementalBuffer(0)}};
-    } else {
-      current_ = {chunk_no, chunks_[chunk_no].start};
-      SkipToPosition(position);
-    }
-
-    // Since position was within the chunk, SkipToPosition should have found
-    // something.
-    DCHECK_EQ(position, current_.pos.chars);
-    return;
-  }
-
-  // What's left: We're in the last, non-terminating chunk. Our position
-  // may be in the chunk, but it may also be in 'future' chunks, which we'll
-  // have to obtain.
-  DCHECK_EQ(chunk_no, chunks_.size() - 1);
-  current_ = {chunk_no, chunks_[chunk_no].start};
-  bool have_more_data = true;
-  bool found = SkipToPosition(position);
-  while (have_more_data && !found) {
-    DCHECK_EQ(current_.chunk_no, chunks_.size());
-    have_more_data = FetchChunk();
-    found = have_more_data && SkipToPosition(position);
-  }
-
-  // We'll return with a postion != the desired position only if we're out
-  // of data. In that case, we'll point to the terminating chunk.
-  DCHECK_EQ(found, current_.pos.chars == position);
-  DCHECK_EQ(have_more_data, chunks_.back().length != 0);
-  DCHECK_IMPLIES(!found, !have_more_data);
-  DCHECK_IMPLIES(!found, current_.chunk_no == chunks_.size() - 1);
-}
-
-size_t Utf8ExternalStreamingStream::FillBuffer(size_t position) {
-  buffer_cursor_ = buffer_;
-  buffer_end_ = buffer_;
-
-  SearchPosition(position);
-  bool out_of_data = current_.chunk_no != chunks_.size() &&
-                     chunks_[current_.chunk_no].length == 0 &&
-                     current_.pos.incomplete_char == 0;
-
-  if (out_of_data) return 0;
-
-  // Fill the buffer, until we have at least one char (or are out of data).
-  // (The embedder might give us 1-byte blocks within a utf-8 char, so we
-  //  can't guarantee progress with one chunk. Thus we iterate.)
-  while (!out_of_data && buffer_cursor_ == buffer_end_) {
-    // At end of current data, but there might be more? Then fetch it.
-    if (current_.chunk_no == chunks_.size()) {
-      out_of_data = !FetchChunk();
-    }
-    FillBufferFromCurrentChunk();
-  }
-
-  DCHECK_EQ(current_.pos.chars - position,
-            static_cast<size_t>(buffer_end_ - buffer_cursor_));
-  return buffer_end_ - buffer_cursor_;
+  size_t start = position - chunk.start_char;
+  size_t length = i::Min(kBufferSize, chunk.data.size() - start);
+  i::CopyCharsUnsigned(buffer_, &chunk.data[start], length);
+  return length;
 }
 
 // ----------------------------------------------------------------------------
@@ -140,16 +140,16 @@ const size_t Scanner::BookmarkScope::kBookmarkWasApplied =
 
 void Scanner::BookmarkScope::Set() {
   DCHECK_EQ(bookmark_, kNoBookmark);
-  DCHECK_EQ(scanner_->next_next_.token, Token::UNINITIALIZED);
+  DCHECK_EQ(scanner_->next_next_->token, Token::UNINITIALIZED);
 
   // The first token is a bit special, since current_ will still be
   // uninitialized. In this case, store kBookmarkAtFirstPos and special-case it
   // when
   // applying the bookmark.
-  DCHECK_IMPLIES(
-      scanner_->current_.token == Token::UNINITIALIZED,
-      scanner_->current_.location.beg_pos == scanner_->next_.location.beg_pos);
-  bookmark_ = (scanner_->current_.token == Token::UNINITIALIZED)
+  DCHECK_IMPLIES(scanner_->current_->token == Token::UNINITIALIZED,
+                 scanner_->current_->location.beg_pos ==
+                     scanner_->next_->location.beg_pos);
+  bookmark_ = (scanner_->current_->token == Token::UNINITIALIZED)
                   ? kBookmarkAtFirstPos
                   : scanner_->location().beg_pos;
 }
@@ -194,6 +194,9 @@ bool Scanner::IsLineTerminator(uc32 c) {
 
 Scanner::Scanner(UnicodeCache* unicode_cache, int* use_counts)
     : unicode_cache_(unicode_cache),
+      current_(&token_storage_[0]),
+      next_(&token_storage_[1]),
+      next_next_(&token_storage_[2]),
       octal_pos_(Location::invalid()),
       octal_message_(MessageTemplate::kNone),
       found_html_comment_(false),
@@ -391,58 +394,71 @@ static const byte one_char_tokens[] = {
 
 
 Token::Value Scanner::Next() {
-  if (next_.token == Token::EOS) {
-    next_.location.beg_pos = current_.location.beg_pos;
-    next_.location.end_pos = current_.location.end_pos;
+  if (next_->token == Token::EOS) {
+    next_->location.beg_pos = current_->location.beg_pos;
+    next_->location.end_pos = current_->location.end_pos;
   }
+  // Rotate through the three token descs instead of copying them; the desc
+  // that held the previous current token becomes the scratch slot for the
+  // token scanned next.
+  TokenDesc* previous = current_;
   current_ = next_;
-  if (V8_UNLIKELY(next_next_.token != Token::UNINITIALIZED)) {
+  if (V8_UNLIKELY(next_next_->token != Token::UNINITIALIZED)) {
     next_ = next_next_;
-    next_next_.token = Token::UNINITIALIZED;
-    next_next_.contextual_token = Token::UNINITIALIZED;
+    next_next_ = previous;
+    next_next_->token = Token::UNINITIALIZED;
+    next_next_->contextual_token = Token::UNINITIALIZED;
     has_line_terminator_before_next_ = has_line_terminator_after_next_;
-    return current_.token;
+    return current_->token;
   }
+  next_ = previous;
   has_line_terminator_before_next_ = false;
   has_multiline_comment_before_next_ = false;
   if (static_cast<unsigned>(c0_) <= 0x7f) {
     Token::Value token = static_cast<Token::Value>(one_char_tokens[c0_]);
     if (token != Token::ILLEGAL) {
       int pos = source_pos();
-      next_.token = token;
-      next_.contextual_token = Token::UNINITIALIZED;
-      next_.location.beg_pos = pos;
-      next_.location.end_pos = pos + 1;
-      next_.literal_chars = nullptr;
-      next_.raw_literal_chars = nullptr;
-      next_.invalid_template_escape_message = MessageTemplate::kNone;
+      next_->token = token;
+      next_->contextual_token = Token::UNINITIALIZED;
+      next_->location.beg_pos = pos;
+      next_->location.end_pos = pos + 1;
+      next_->literal_chars = nullptr;
+      next_->raw_literal_chars = nullptr;
+      next_->invalid_template_escape_message = MessageTemplate::kNone;
       Advance();
-      return current_.token;
+      return current_->token;
     }
   }
   Scan();
-  return current_.token;
+  return current_->token;
 }
 
 
 Token::Value Scanner::PeekAhead() {
-  DCHECK(next_.token != Token::DIV);
-  DCHECK(next_.token != Token::ASSIGN_DIV);
+  DCHECK(next_->token != Token::DIV);
+  DCHECK(next_->token != Token::ASSIGN_DIV);
 
-  if (next_next_.token != Token::UNINITIALIZED) {
-    return next_next_.token;
+  if (next_next_->token != Token::UNINITIALIZED) {
+    return next_next_->token;
   }
-  TokenDesc prev = current_;
+  // Next() rotates the current token's desc into the scratch position, so
+  // save its contents and restore them into the desc that next_next_ points
+  // at (unused while next_next_ is UNINITIALIZED) once the look-ahead token
+  // has been scanned. PeekAhead() is rare enough that this one copy does not
+  // matter.
+  TokenDesc* free_desc = next_next_;
+  TokenDesc saved_current = *current_;
   bool has_line_terminator_before_next =
       has_line_terminator_before_next_ || has_multiline_comment_before_next_;
   Next();
   has_line_terminator_after_next_ =
       has_line_terminator_before_next_ || has_multiline_comment_before_next_;
   has_line_terminator_before_next_ = has_line_terminator_before_next;
-  Token::Value ret = next_.token;
+  Token::Value ret = next_->token;
   next_next_ = next_;
   next_ = current_;
-  current_ = prev;
+  current_ = free_desc;
+  *current_ = saved_current;
   return ret;
 }
 
@@ -451,10 +467,8 @@ Token::Value Scanner::SkipWhiteSpace() {
   int start_position = source_pos();
 
   while (true) {
-    while (true) {
-      // Don't skip behind the end of input.
-      if (c0_ == kEndOfInput) break;
-
+    // Don't skip behind the end of input.
+    while (c0_ != kEndOfInput) {
       // Advance as long as character is a WhiteSpace or LineTerminator.
       // Remember if the latter is the case.
       if (IsLineTerminator(c0_)) {
@@ -462,7 +476,15 @@ Token::Value Scanner::SkipWhiteSpace() {
       } else if (!unicode_cache_->IsWhiteSpace(c0_)) {
         break;
       }
-      Advance();
+      // Skip the remainder of the run block-at-a-time; the predicate stops
+      // the stream at the first character that is neither.
+      AdvanceUntil([this](uc32 c0) {
+        if (IsLineTerminator(c0)) {
+          has_line_terminator_before_next_ = true;
+          return false;
+        }
+        return !unicode_cache_->IsWhiteSpace(c0);
+      });
     }
 
     // If there is an HTML comment end '-->' at the beginning of a
@@ -507,16 +529,12 @@ Token::Value Scanner::SkipSingleHTMLComment() {
 }
 
 Token::Value Scanner::SkipSingleLineComment() {
-  Advance();
-
   // The line terminator at the end of the line is not considered
   // to be part of the single-line comment; it is recognized
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  while (c0_ != kEndOfInput && !IsLineTerminator(c0_)) {
-    Advance();
-  }
+  AdvanceUntil([this](uc32 c0) { return IsLineTerminator(c0); });
 
   return Token::WHITESPACE;
 }
@@ -524,8 +542,8 @@ Token::Value Scanner::SkipSingleLineComment() {
 
 Token::Value Scanner::SkipSourceURLComment() {
   TryToParseSourceURLComment();
-  while (c0_ != kEndOfInput && !IsLineTerminator(c0_)) {
-    Advance();
+  if (c0_ != kEndOfInput && !IsLineTerminator(c0_)) {
+    AdvanceUntil([this](uc32 c0) { return IsLineTerminator(c0); });
   }
 
   return Token::WHITESPACE;
@@ -628,13 +646,13 @@ Token::Value Scanner::ScanHtmlComment() {
 }
 
 void Scanner::Scan() {
-  next_.literal_chars = nullptr;
-  next_.raw_literal_chars = nullptr;
-  next_.invalid_template_escape_message = MessageTemplate::kNone;
+  next_->literal_chars = nullptr;
+  next_->raw_literal_chars = nullptr;
+  next_->invalid_template_escape_message = MessageTemplate::kNone;
   Token::Value token;
   do {
     // Remember the position of the next token
-    next_.location.beg_pos = source_pos();
+    next_->location.beg_pos = source_pos();
 
     switch (c0_) {
       case ' ':
@@ -895,19 +913,19 @@ void Scanner::Scan() {
     // whitespace.
   } while (token == Token::WHITESPACE);
 
-  next_.location.end_pos = source_pos();
+  next_->location.end_pos = source_pos();
   if (Token::IsContextualKeyword(token)) {
-    next_.token = Token::IDENTIFIER;
-    next_.contextual_token = token;
+    next_->token = Token::IDENTIFIER;
+    next_->contextual_token = token;
   } else {
-    next_.token = token;
-    next_.contextual_token = Token::UNINITIALIZED;
+    next_->token = token;
+    next_->contextual_token = Token::UNINITIALIZED;
   }
 
 #ifdef DEBUG
-  SanityCheckTokenDesc(current_);
-  SanityCheckTokenDesc(next_);
-  SanityCheckTokenDesc(next_next_);
+  SanityCheckTokenDesc(*current_);
+  SanityCheckTokenDesc(*next_);
+  SanityCheckTokenDesc(*next_next_);
 #endif
 }
 
@@ -963,9 +981,9 @@ void Scanner::SanityCheckTokenDesc(const TokenDesc& token) const {
 void Scanner::SeekForward(int pos) {
   // After this call, we will have the token at the given position as
   // the "next" token. The "current" token will be invalid.
-  if (pos == next_.location.beg_pos) return;
+  if (pos == next_->location.beg_pos) return;
   int current_pos = source_pos();
-  DCHECK_EQ(next_.location.end_pos, current_pos);
+  DCHECK_EQ(next_->location.end_pos, current_pos);
   // Positions inside the lookahead token aren't supported.
   DCHECK(pos >= current_pos);
   if (pos != current_pos) {
@@ -1155,8 +1173,8 @@ Token::Value Scanner::ScanTemplateSpan() {
         DCHECK_EQ(!success, has_error());
         // For templates, invalid escape sequence checking is handled in the
         // parser.
-        scanner_error_state.MoveErrorTo(&next_);
-        octal_error_state.MoveErrorTo(&next_);
+        scanner_error_state.MoveErrorTo(next_);
+        octal_error_state.MoveErrorTo(next_);
       }
     } else if (c < 0) {
       // Unterminated template literal
@@ -1179,18 +1197,18 @@ Token::Value Scanner::ScanTemplateSpan() {
     }
   }
   literal.Complete();
-  next_.location.end_pos = source_pos();
-  next_.token = result;
-  next_.contextual_token = Token::UNINITIALIZED;
+  next_->location.end_pos = source_pos();
+  next_->token = result;
+  next_->contextual_token = Token::UNINITIALIZED;
 
   return result;
 }
 
 
 Token::Value Scanner::ScanTemplateStart() {
-  DCHECK_EQ(next_next_.token, Token::UNINITIALIZED);
+  DCHECK_EQ(next_next_->token, Token::UNINITIALIZED);
   DCHECK_EQ(c0_, '`');
-  next_.location.beg_pos = source_pos();
+  next_->location.beg_pos = source_pos();
   Advance();  // Consume `
   return ScanTemplateSpan();
 }
@@ -1306,10 +1324,10 @@ Token::Value Scanner::ScanNumber(bool seen_period) {
           AddLiteralChar(first_char);
         }
 
-        if (next_.literal_chars->one_byte_literal().length() <= 10 &&
+        if (next_->literal_chars->one_byte_literal().length() <= 10 &&
             value <= Smi::kMaxValue && c0_ != '.' &&
             (c0_ == kEndOfInput || !unicode_cache_->IsIdentifierStart(c0_))) {
-          next_.smi_value_ = static_cast<uint32_t>(value);
+          next_->smi_value_ = static_cast<uint32_t>(value);
           literal.Complete();
           HandleLeadSurrogate();
 
@@ -1569,7 +1587,7 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
       }
     } else if (c0_ <= kMaxAscii && c0_ != '\\') {
       // Only a-z+ or _: could be a keyword or identifier.
-      Vector<const uint8_t> chars = next_.literal_chars->one_byte_literal();
+      Vector<const uint8_t> chars = next_->literal_chars->one_byte_literal();
       Token::Value token =
           KeywordOrIdentifierToken(chars.start(), chars.length());
       if (token == Token::IDENTIFIER ||
@@ -1622,8 +1640,8 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
     return ScanIdentifierSuffix(&literal, false);
   }
 
-  if (next_.literal_chars->is_one_byte()) {
-    Vector<const uint8_t> chars = next_.literal_chars->one_byte_literal();
+  if (next_->literal_chars->is_one_byte()) {
+    Vector<const uint8_t> chars = next_->literal_chars->one_byte_literal();
     Token::Value token =
         KeywordOrIdentifierToken(chars.start(), chars.length());
     if (token == Token::IDENTIFIER ||
@@ -1658,8 +1676,8 @@ Token::Value Scanner::ScanIdentifierSuffix(LiteralScope* literal,
   }
   literal->Complete();
 
-  if (escaped && next_.literal_chars->is_one_byte()) {
-    Vector<const uint8_t> chars = next_.literal_chars->one_byte_literal();
+  if (escaped && next_->literal_chars->is_one_byte()) {
+    Vector<const uint8_t> chars = next_->literal_chars->one_byte_literal();
     Token::Value token =
         KeywordOrIdentifierToken(chars.start(), chars.length());
     /* TODO (adamk): YIELD should be handled specially.  id:1166 gh:1174*/
@@ -1676,17 +1694,17 @@ Token::Value Scanner::ScanIdentifierSuffix(LiteralScope* literal,
 }
 
 bool Scanner::ScanRegExpPattern() {
-  DCHECK(next_next_.token == Token::UNINITIALIZED);
-  DCHECK(next_.token == Token::DIV || next_.token == Token::ASSIGN_DIV);
+  DCHECK(next_next_->token == Token::UNINITIALIZED);
+  DCHECK(next_->token == Token::DIV || next_->token == Token::ASSIGN_DIV);
 
   // Scan: ('/' | '/=') RegularExpressionBody '/' RegularExpressionFlags
   bool in_character_class = false;
-  bool seen_equal = (next_.token == Token::ASSIGN_DIV);
+  bool seen_equal = (next_->token == Token::ASSIGN_DIV);
 
   // Previous token is either '/' or '/=', in the second case, the
   // pattern starts at =.
-  next_.location.beg_pos = source_pos() - (seen_equal ? 2 : 1);
-  next_.location.end_pos = source_pos() - (seen_equal ? 1 : 0);
+  next_->location.beg_pos = source_pos() - (seen_equal ? 2 : 1);
+  next_->location.end_pos = source_pos() - (seen_equal ? 1 : 0);
 
   // Scan regular expression body: According to ECMA-262, 3rd, 7.8.5,
   // the scanner should pass uninterpreted bodies to the RegExp
@@ -1725,14 +1743,14 @@ bool Scanner::ScanRegExpPattern() {
   Advance();  // consume '/'
 
   literal.Complete();
-  next_.token = Token::REGEXP_LITERAL;
-  next_.contextual_token = Token::UNINITIALIZED;
+  next_->token = Token::REGEXP_LITERAL;
+  next_->contextual_token = Token::UNINITIALIZED;
   return true;
 }
 
 
 Maybe<RegExp::Flags> Scanner::ScanRegExpFlags() {
-  DCHECK(next_.token == Token::REGEXP_LITERAL);
+  DCHECK(next_->token == Token::REGEXP_LITERAL);
 
   // Scan regular expression flags.
   int flags = 0;
@@ -1771,7 +1789,7 @@ Maybe<RegExp::Flags> Scanner::ScanRegExpFlags() {
     flags |= flag;
   }
 
-  next_.location.end_pos = source_pos();
+  next_->location.end_pos = source_pos();
   return Just(RegExp::Flags(flags));
 }
 
@@ -1834,24 +1852,24 @@ void Scanner::SeekNext(size_t position) {
   // 1, Reset the current_, next_ and next_next_ tokens
   //    (next_ + next_next_ will be overwrittem by Next(),
   //     current_ will remain unchanged, so overwrite it fully.)
-  current_ = {{0, 0},
-              nullptr,
-              nullptr,
-              0,
-              Token::UNINITIALIZED,
-              MessageTemplate::kNone,
-              {0, 0},
-              Token::UNINITIALIZED};
-  next_.token = Token::UNINITIALIZED;
-  next_.contextual_token = Token::UNINITIALIZED;
-  next_next_.token = Token::UNINITIALIZED;
-  next_next_.contextual_token = Token::UNINITIALIZED;
+  *current_ = {{0, 0},
+               nullptr,
+               nullptr,
+               0,
+               Token::UNINITIALIZED,
+               MessageTemplate::kNone,
+               {0, 0},
+               Token::UNINITIALIZED};
+  next_->token = Token::UNINITIALIZED;
+  next_->contextual_token = Token::UNINITIALIZED;
+  next_next_->token = Token::UNINITIALIZED;
+  next_next_->contextual_token = Token::UNINITIALIZED;
   // 2, reset the source to the desired position,
   source_->Seek(position);
   // 3, re-scan, by scanning the look-ahead char + 1 token (next_).
   c0_ = source_->Advance();
   Next();
-  DCHECK_EQ(next_.location.beg_pos, static_cast<int>(position));
+  DCHECK_EQ(next_->location.beg_pos, static_cast<int>(position));
 }
 
 }  // namespace internal
@@ -7,6 +7,8 @@
 #ifndef V8_PARSING_SCANNER_H_
 #define V8_PARSING_SCANNER_H_
 
+#include <algorithm>
+
 #include "src/allocation.h"
 #include "src/base/logging.h"
 #include "src/char-predicates.h"
@@ -55,6 +57,35 @@ class Utf16CharacterStream {
     }
   }
 
+  // Advances the stream up to (and including) the first code unit for which
+  // the check predicate returns true, and returns that code unit. Code units
+  // the predicate rejects are skipped block-at-a-time, which the compiler can
+  // turn into vectorized code for simple predicates; use this instead of an
+  // Advance() loop when skipping long runs (e.g. whitespace or comments).
+  // Returns kEndOfInput if the predicate matches no remaining code unit.
+  template <typename FunctionType>
+  V8_INLINE uc32 AdvanceUntil(FunctionType check) {
+    while (true) {
+      auto next_cursor_pos =
+          std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t raw_c0) {
+            uc32 c0 = static_cast<uc32>(raw_c0);
+            return check(c0);
+          });
+
+      if (next_cursor_pos == buffer_end_) {
+        buffer_cursor_ = buffer_end_;
+        if (!ReadBlockChecked()) {
+          // See the comment in Advance() on why this increment is necessary.
+          buffer_cursor_++;
+          return kEndOfInput;
+        }
+      } else {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<uc32>(*next_cursor_pos);
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -216,14 +247,14 @@ class Scanner {
   // Returns the token following peek()
   Token::Value PeekAhead();
   // Returns the current token again.
-  Token::Value current_token() { return current_.token; }
+  Token::Value current_token() { return current_->token; }
 
-  Token::Value current_contextual_token() { return current_.contextual_token; }
-  Token::Value next_contextual_token() { return next_.contextual_token; }
+  Token::Value current_contextual_token() { return current_->contextual_token; }
+  Token::Value next_contextual_token() { return next_->contextual_token; }
 
   // Returns the location information for the current token
   // (the token last returned by Next()).
-  Location location() const { return current_.location; }
+  Location location() const { return current_->location; }
 
   // This error is specifically an invalid hex or unicode escape sequence.
   bool has_error() const { return scanner_error_ != MessageTemplate::kNone; }
@@ -231,26 +262,26 @@ class Scanner {
   Location error_location() const { return scanner_error_location_; }
 
   bool has_invalid_template_escape() const {
-    return current_.invalid_template_escape_message != MessageTemplate::kNone;
+    return current_->invalid_template_escape_message != MessageTemplate::kNone;
   }
   MessageTemplate::Template invalid_template_escape_message() const {
     DCHECK(has_invalid_template_escape());
-    return current_.invalid_template_escape_message;
+    return current_->invalid_template_escape_message;
   }
   Location invalid_template_escape_location() const {
     DCHECK(has_invalid_template_escape());
-    return current_.invalid_template_escape_location;
+    return current_->invalid_template_escape_location;
   }
 
   // Similar functions for the upcoming token.
 
   // One token look-ahead (past the token returned by Next()).
-  Token::Value peek() const { return next_.token; }
+  Token::Value peek() const { return next_->token; }
 
-  Location peek_location() const { return next_.location; }
+  Location peek_location() const { return next_->location; }
 
   bool literal_contains_escapes() const {
-    return LiteralContainsEscapes(current_);
+    return LiteralContainsEscapes(*current_);
   }
 
   const AstRawString* CurrentSymbol(AstValueFactory* ast_value_factory) const;
@@ -264,12 +295,12 @@ class Scanner {
 
   inline bool CurrentMatches(Token::Value token) const {
     DCHECK(Token::IsKeyword(token));
-    return current_.token == token;
+    return current_->token == token;
   }
 
   inline bool CurrentMatchesContextual(Token::Value token) const {
     DCHECK(Token::IsContextualKeyword(token));
-    return current_.contextual_token == token;
+    return current_->contextual_token == token;
   }
 
   // Match the token against the contextual keyword or literal buffer.
@@ -278,17 +309,17 @@ class Scanner {
     // Escaped keywords are not matched as tokens. So if we require escape
     // and/or string processing we need to look at the literal content
     // (which was escape-processed already).
-    // Conveniently, current_.literal_chars == nullptr for all proper keywords,
+    // Conveniently, current_->literal_chars == nullptr for all proper keywords,
     // so this second condition should exit early in common cases.
-    return (current_.contextual_token == token) ||
-           (current_.literal_chars &&
-            current_.literal_chars->Equals(Vector<const char>(
+    return (current_->contextual_token == token) ||
+           (current_->literal_chars &&
+            current_->literal_chars->Equals(Vector<const char>(
                 Token::String(token), Token::StringLength(token))));
   }
 
   bool IsUseStrict() const {
-    return current_.token == Token::STRING &&
-           current_.literal_chars->Equals(
+    return current_->token == Token::STRING &&
+           current_->literal_chars->Equals(
                Vector<const char>("use strict", strlen("use strict")));
   }
   bool IsGetOrSet(bool* is_get, bool* is_set) const {
@@ -318,7 +349,7 @@ class Scanner {
   MessageTemplate::Template octal_message() const { return octal_message_; }
 
   // Returns the value of the last smi that was scanned.
-  uint32_t smi_value() const { return current_.smi_value_; }
+  uint32_t smi_value() const { return current_->smi_value_; }
 
   // Seek forward to the given position.  This operation does not
   // work in general, for instance when there are pushed back
@@ -348,8 +379,8 @@ class Scanner {
   // Scans the input as a template literal
   Token::Value ScanTemplateStart();
   Token::Value ScanTemplateContinuation() {
-    DCHECK_EQ(next_.token, Token::RBRACE);
-    next_.location.beg_pos = source_pos() - 1;  // We already consumed }
+    DCHECK_EQ(next_->token, Token::RBRACE);
+    next_->location.beg_pos = source_pos() - 1;  // We already consumed }
     return ScanTemplateSpan();
   }
 
@@ -497,21 +528,21 @@ class Scanner {
     STATIC_ASSERT(kCharacterLookaheadBufferSize == 1);
     Advance();
     // Initialize current_ to not refer to a literal.
-    current_.token = Token::UNINITIALIZED;
-    current_.contextual_token = Token::UNINITIALIZED;
-    current_.literal_chars = nullptr;
-    current_.raw_literal_chars = nullptr;
-    current_.invalid_template_escape_message = MessageTemplate::kNone;
-    next_.token = Token::UNINITIALIZED;
-    next_.contextual_token = Token::UNINITIALIZED;
-    next_.literal_chars = nullptr;
-    next_.raw_literal_chars = nullptr;
-    next_.invalid_template_escape_message = MessageTemplate::kNone;
-    next_next_.token = Token::UNINITIALIZED;
-    next_next_.contextual_token = Token::UNINITIALIZED;
-    next_next_.literal_chars = nullptr;
-    next_next_.raw_literal_chars = nullptr;
-    next_next_.invalid_template_escape_message = MessageTemplate::kNone;
+    current_->token = Token::UNINITIALIZED;
+    current_->contextual_token = Token::UNINITIALIZED;
+    current_->literal_chars = nullptr;
+    current_->raw_literal_chars = nullptr;
+    current_->invalid_template_escape_message = MessageTemplate::kNone;
+    next_->token = Token::UNINITIALIZED;
+    next_->contextual_token = Token::UNINITIALIZED;
+    next_->literal_chars = nullptr;
+    next_->raw_literal_chars = nullptr;
+    next_->invalid_template_escape_message = MessageTemplate::kNone;
+    next_next_->token = Token::UNINITIALIZED;
+    next_next_->contextual_token = Token::UNINITIALIZED;
+    next_next_->literal_chars = nullptr;
+    next_next_->raw_literal_chars = nullptr;
+    next_next_->invalid_template_escape_message = MessageTemplate::kNone;
     found_html_comment_ = false;
     scanner_error_ = MessageTemplate::kNone;
   }
@@ -535,50 +566,50 @@ class Scanner {
   // Literal buffer support
   inline void StartLiteral() {
     LiteralBuffer* free_buffer =
-        (current_.literal_chars == &literal_buffer0_)
+        (current_->literal_chars == &literal_buffer0_)
             ? &literal_buffer1_
-            : (current_.literal_chars == &literal_buffer1_) ? &literal_buffer2_
+            : (current_->literal_chars == &literal_buffer1_) ? &literal_buffer2_
                                                             : &literal_buffer0_;
     free_buffer->Reset();
-    next_.literal_chars = free_buffer;
+    next_->literal_chars = free_buffer;
   }
 
   inline void StartRawLiteral() {
     LiteralBuffer* free_buffer =
-        (current_.raw_literal_chars == &raw_literal_buffer0_)
+        (current_->raw_literal_chars == &raw_literal_buffer0_)
             ? &raw_literal_buffer1_
-            : (current_.raw_literal_chars == &raw_literal_buffer1_)
+            : (current_->raw_literal_chars == &raw_literal_buffer1_)
                   ? &raw_literal_buffer2_
                   : &raw_literal_buffer0_;
     free_buffer->Reset();
-    next_.raw_literal_chars = free_buffer;
+    next_->raw_literal_chars = free_buffer;
   }
 
   INLINE(void AddLiteralChar(uc32 c)) {
-    DCHECK_NOT_NULL(next_.literal_chars);
-    next_.literal_chars->AddChar(c);
+    DCHECK_NOT_NULL(next_->literal_chars);
+    next_->literal_chars->AddChar(c);
   }
 
   INLINE(void AddLiteralChar(char c)) {
-    DCHECK_NOT_NULL(next_.literal_chars);
-    next_.literal_chars->AddChar(c);
+    DCHECK_NOT_NULL(next_->literal_chars);
+    next_->literal_chars->AddChar(c);
   }
 
   INLINE(void AddRawLiteralChar(uc32 c)) {
-    DCHECK_NOT_NULL(next_.raw_literal_chars);
-    next_.raw_literal_chars->AddChar(c);
+    DCHECK_NOT_NULL(next_->raw_literal_chars);
+    next_->raw_literal_chars->AddChar(c);
   }
 
   INLINE(void ReduceRawLiteralLength(int delta)) {
-    DCHECK_NOT_NULL(next_.raw_literal_chars);
-    next_.raw_literal_chars->ReduceLength(delta);
+    DCHECK_NOT_NULL(next_->raw_literal_chars);
+    next_->raw_literal_chars->ReduceLength(delta);
   }
 
   // Stops scanning of a literal and drop the collected characters,
   // e.g., due to an encountered error.
   inline void DropLiteral() {
-    next_.literal_chars = nullptr;
-    next_.raw_literal_chars = nullptr;
+    next_->literal_chars = nullptr;
+    next_->raw_literal_chars = nullptr;
   }
 
   inline void AddLiteralCharAdvance() {
@@ -596,6 +627,17 @@ class Scanner {
     if (check_surrogate) HandleLeadSurrogate();
   }
 
+  // Skips ahead to the first character for which the check predicate returns
+  // true and makes it the current character. The predicate only ever sees
+  // individual code units; if the stopping character is a lead surrogate the
+  // pair is combined as in Advance(). Skipped characters are not captured as
+  // raw literal characters.
+  template <typename FunctionType>
+  V8_INLINE void AdvanceUntil(FunctionType check) {
+    c0_ = source_->AdvanceUntil(check);
+    HandleLeadSurrogate();
+  }
+
   void HandleLeadSurrogate() {
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
       uc32 c1 = source_->Advance();
@@ -653,45 +695,45 @@ class Scanner {
   // token as a one-byte literal. E.g. Token::FUNCTION pretends to have a
   // literal "function".
   Vector<const uint8_t> literal_one_byte_string() const {
-    if (current_.literal_chars)
-      return current_.literal_chars->one_byte_literal();
-    const char* str = Token::String(current_.token);
+    if (current_->literal_chars)
+      return current_->literal_chars->one_byte_literal();
+    const char* str = Token::String(current_->token);
     const uint8_t* str_as_uint8 = reinterpret_cast<const uint8_t*>(str);
     return Vector<const uint8_t>(str_as_uint8,
-                                 Token::StringLength(current_.token));
+                                 Token::StringLength(current_->token));
   }
   Vector<const uint16_t> literal_two_byte_string() const {
-    DCHECK_NOT_NULL(current_.literal_chars);
-    return current_.literal_chars->two_byte_literal();
+    DCHECK_NOT_NULL(current_->literal_chars);
+    return current_->literal_chars->two_byte_literal();
   }
   bool is_literal_one_byte() const {
-    return !current_.literal_chars || current_.literal_chars->is_one_byte();
+    return !current_->literal_chars || current_->literal_chars->is_one_byte();
   }
   // Returns the literal string for the next token (the token that
   // would be returned if Next() were called).
   Vector<const uint8_t> next_literal_one_byte_string() const {
-    DCHECK_NOT_NULL(next_.literal_chars);
-    return next_.literal_chars->one_byte_literal();
+    DCHECK_NOT_NULL(next_->literal_chars);
+    return next_->literal_chars->one_byte_literal();
   }
   Vector<const uint16_t> next_literal_two_byte_string() const {
-    DCHECK_NOT_NULL(next_.literal_chars);
-    return next_.literal_chars->two_byte_literal();
+    DCHECK_NOT_NULL(next_->literal_chars);
+    return next_->literal_chars->two_byte_literal();
   }
   bool is_next_literal_one_byte() const {
-    DCHECK_NOT_NULL(next_.literal_chars);
-    return next_.literal_chars->is_one_byte();
+    DCHECK_NOT_NULL(next_->literal_chars);
+    return next_->literal_chars->is_one_byte();
   }
   Vector<const uint8_t> raw_literal_one_byte_string() const {
-    DCHECK_NOT_NULL(current_.raw_literal_chars);
-    return current_.raw_literal_chars->one_byte_literal();
+    DCHECK_NOT_NULL(current_->raw_literal_chars);
+    return current_->raw_literal_chars->one_byte_literal();
   }
   Vector<const uint16_t> raw_literal_two_byte_string() const {
-    DCHECK_NOT_NULL(current_.raw_literal_chars);
-    return current_.raw_literal_chars->two_byte_literal();
+    DCHECK_NOT_NULL(current_->raw_literal_chars);
+    return current_->raw_literal_chars->two_byte_literal();
   }
   bool is_raw_literal_one_byte() const {
-    DCHECK_NOT_NULL(current_.raw_literal_chars);
-    return current_.raw_literal_chars->is_one_byte();
+    DCHECK_NOT_NULL(current_->raw_literal_chars);
+    return current_->raw_literal_chars->is_one_byte();
   }
 
   template <bool capture_raw, bool unicode = false>
@@ -776,9 +818,14 @@ class Scanner {
   LiteralBuffer raw_literal_buffer1_;
   LiteralBuffer raw_literal_buffer2_;
 
-  TokenDesc current_;    // desc for current token (as returned by Next())
-  TokenDesc next_;       // desc for next token (one token look-ahead)
-  TokenDesc next_next_;  // desc for the token after next (after PeakAhead())
+  // The current_, next_ and next_next_ descs rotate through token_storage_,
+  // so advancing never copies a TokenDesc; tokens are scanned in place and
+  // handed on by pointer rotation in Next() and PeekAhead().
+  TokenDesc token_storage_[3];
+
+  TokenDesc* current_;    // desc for current token (as returned by Next())
+  TokenDesc* next_;       // desc for next token (one token look-ahead)
+  TokenDesc* next_next_;  // desc for the token after next (after PeakAhead())
 
   // Input stream. Must be initialized to an Utf16CharacterStream.
   Utf16CharacterStream* source_;
@@ -52,6 +52,17 @@ RUNTIME_FUNCTION(Runtime_SetShrink) {
   return isolate->heap()->undefined_value();
 }
 
+RUNTIME_FUNCTION(Runtime_SetReserve) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSSet, holder, 0);
+  CONVERT_SMI_ARG_CHECKED(capacity, 1);
+  DCHECK_EQ(0, OrderedHashSet::cast(holder->table())->NumberOfElements());
+  capacity = Min(capacity, OrderedHashSet::kMaxCapacity / 2);
+  holder->set_table(*OrderedHashSet::Allocate(isolate, capacity));
+  return isolate->heap()->undefined_value();
+}
+
 RUNTIME_FUNCTION(Runtime_SetIteratorClone) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
@@ -82,6 +93,17 @@ RUNTIME_FUNCTION(Runtime_MapGrow) {
   return isolate->heap()->undefined_value();
 }
 
+RUNTIME_FUNCTION(Runtime_MapReserve) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSMap, holder, 0);
+  CONVERT_SMI_ARG_CHECKED(capacity, 1);
+  DCHECK_EQ(0, OrderedHashMap::cast(holder->table())->NumberOfElements());
+  capacity = Min(capacity, OrderedHashMap::kMaxCapacity / 2);
+  holder->set_table(*OrderedHashMap::Allocate(isolate, capacity));
+  return isolate->heap()->undefined_value();
+}
+
 RUNTIME_FUNCTION(Runtime_MapIteratorClone) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
@@ -357,6 +357,40 @@ RUNTIME_FUNCTION(Runtime_StringBuilderConcat) {
   }
 }
 
+template <typename sinkchar>
+static void JoinArrayWithSeparator(FixedArray* fixed_array, int array_length,
+                                   String* separator,
+                                   Vector<sinkchar> buffer) {
+  DisallowHeapAllocation no_gc;
+
+  int separator_length = separator->length();
+  sinkchar* sink = buffer.start();
+#ifdef DEBUG
+  sinkchar* end = sink + buffer.length();
+#endif
+
+  CHECK(fixed_array->get(0)->IsString());
+  String* first = String::cast(fixed_array->get(0));
+
+  int first_length = first->length();
+  String::WriteToFlat(first, sink, 0, first_length);
+  sink += first_length;
+
+  for (int i = 1; i < array_length; i++) {
+    DCHECK(sink + separator_length <= end);
+    String::WriteToFlat(separator, sink, 0, separator_length);
+    sink += separator_length;
+
+    CHECK(fixed_array->get(i)->IsString());
+    String* element = String::cast(fixed_array->get(i));
+    int element_length = element->length();
+    DCHECK(sink + element_length <= end);
+    String::WriteToFlat(element, sink, 0, element_length);
+    sink += element_length;
+  }
+  DCHECK(sink == end);
+}
+
 RUNTIME_FUNCTION(Runtime_StringBuilderJoin) {
   HandleScope scope(isolate);
   DCHECK_EQ(3, args.length());
@@ -390,6 +424,7 @@ RUNTIME_FUNCTION(Runtime_StringBuilderJoin) {
     THROW_NEW_ERROR_RETURN_FAILURE(isolate, NewInvalidStringLengthError());
   }
   int length = (array_length - 1) * separator_length;
+  bool one_byte = separator->HasOnlyOneByteChars();
   for (int i = 0; i < array_length; i++) {
     Object* element_obj = fixed_array->get(i);
     CHECK(element_obj->IsString());
@@ -401,44 +436,26 @@ RUNTIME_FUNCTION(Runtime_StringBuilderJoin) {
       break;
     }
     length += increment;
+    if (one_byte && !element->HasOnlyOneByteChars()) {
+      one_byte = false;
+    }
   }
 
-  Handle<SeqTwoByteString> answer;
-  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-      isolate, answer, isolate->factory()->NewRawTwoByteString(length));
-
-  DisallowHeapAllocation no_gc;
-
-  uc16* sink = answer->GetChars();
-#ifdef DEBUG
-  uc16* end = sink + length;
-#endif
-
-  CHECK(fixed_array->get(0)->IsString());
-  String* first = String::cast(fixed_array->get(0));
-  String* separator_raw = *separator;
-
-  int first_length = first->length();
-  String::WriteToFlat(first, sink, 0, first_length);
-  sink += first_length;
-
-  for (int i = 1; i < array_length; i++) {
-    DCHECK(sink + separator_length <= end);
-    String::WriteToFlat(separator_raw, sink, 0, separator_length);
-    sink += separator_length;
-
-    CHECK(fixed_array->get(i)->IsString());
-    String* element = String::cast(fixed_array->get(i));
-    int element_length = element->length();
-    DCHECK(sink + element_length <= end);
-    String::WriteToFlat(element, sink, 0, element_length);
-    sink += element_length;
+  if (one_byte) {
+    Handle<SeqOneByteString> answer;
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, answer, isolate->factory()->NewRawOneByteString(length));
+    JoinArrayWithSeparator(*fixed_array, array_length, *separator,
+                           Vector<uint8_t>(answer->GetChars(), length));
+    return *answer;
+  } else {
+    Handle<SeqTwoByteString> answer;
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, answer, isolate->factory()->NewRawTwoByteString(length));
+    JoinArrayWithSeparator(*fixed_array, array_length, *separator,
+                           Vector<uc16>(answer->GetChars(), length));
+    return *answer;
   }
-  DCHECK(sink == end);
-
-  // Use %_FastOneByteArrayJoin instead.
-  DCHECK(!answer->IsOneByteRepresentation());
-  return *answer;
 }
 
 template <typename sinkchar>
@@ -105,9 +105,11 @@ namespace internal {
   F(GetExistingHash, 1, 1)                \
   F(SetGrow, 1, 1)                        \
   F(SetShrink, 1, 1)                      \
+  F(SetReserve, 2, 1)                     \
   F(SetIteratorClone, 1, 1)               \
   F(MapShrink, 1, 1)                      \
   F(MapGrow, 1, 1)                        \
+  F(MapReserve, 2, 1)                     \
   F(MapIteratorClone, 1, 1)               \
   F(GetWeakMapEntries, 2, 1)              \
   F(WeakCollectionInitialize, 1, 1)       \
@@ -225,7 +227,8 @@ namespace internal {
 #define FOR_EACH_INTRINSIC_INTERPRETER(F)          \
   FOR_EACH_INTRINSIC_INTERPRETER_TRACE(F)          \
   FOR_EACH_INTRINSIC_INTERPRETER_TRACE_FEEDBACK(F) \
-  F(InterpreterNewClosure, 4, 1)
+  F(InterpreterNewClosure, 4, 1)                   \
+  F(InterpreterDeserializeLazy, 2, 1)
 
 #define FOR_EACH_INTRINSIC_FUNCTION(F)     \
   F(FunctionGetName, 1, 1)                 \
@@ -87,10 +87,13 @@ BuiltinDeserializerAllocator::CreateReservationsForEagerBuiltinsAndHandlers() {
 
   BSU::ForEachBytecode(
       [=, &result](Bytecode bytecode, OperandScale operand_scale) {
-        // TODO (jgruber): Replace with DeserializeLazy handler. id:1607 gh:1615
-
         if (!BSU::BytecodeHasDedicatedHandler(bytecode, operand_scale)) return;
 
+        // Skip lazy handlers. These will be replaced by the DeserializeLazy
+        // handler in DeserializeEagerBuiltinsAndHandlers and thus require no
+        // reserved space.
+        if (deserializer()->IsLazyHandler(bytecode)) return;
+
         const int index = BSU::BytecodeToIndex(bytecode, operand_scale);
         uint32_t handler_size = deserializer()->ExtractCodeObjectSize(index);
         DCHECK_LE(handler_size, MemoryAllocator::PageAreaSize(CODE_SPACE));
@@ -173,9 +176,14 @@ void BuiltinDeserializerAllocator::InitializeFromReservations(
 
   BSU::ForEachBytecode(
       [=, &reservation_index](Bytecode bytecode, OperandScale operand_scale) {
-        // TODO (jgruber): Replace with DeserializeLazy handler. id:1266 gh:1274
-
         if (!BSU::BytecodeHasDedicatedHandler(bytecode, operand_scale)) return;
+
+        // Lazy handlers have no reservation. Their dispatch table entries are
+        // left untouched here and set to the DeserializeLazy handler in
+        // DeserializeEagerBuiltinsAndHandlers, once that handler itself has
+        // been deserialized.
+        if (deserializer()->IsLazyHandler(bytecode)) return;
+
         InitializeHandlerFromReservation(reservation[reservation_index],
                                          bytecode, operand_scale);
         reservation_index++;
@@ -214,6 +222,37 @@ void BuiltinDeserializerAllocator::ReserveAndInitializeBuiltinsTableForBuiltin(
 #endif
 }
 
+void BuiltinDeserializerAllocator::ReserveForHandler(
+    Bytecode bytecode, OperandScale operand_scale) {
+  DCHECK(AllowHeapAllocation::IsAllowed());
+  DCHECK(isolate()->interpreter()->IsDispatchTableInitialized());
+
+  const int code_object_id = BSU::BytecodeToIndex(bytecode, operand_scale);
+  const uint32_t handler_size =
+      deserializer()->ExtractCodeObjectSize(code_object_id);
+  DCHECK_LE(handler_size, MemoryAllocator::PageAreaSize(CODE_SPACE));
+
+  Handle<HeapObject> o =
+      isolate()->factory()->NewCodeForDeserialization(handler_size);
+
+  // Note: After this point and until deserialization finishes, heap allocation
+  // is disallowed. We currently can't safely assert this since we'd need to
+  // pass the DisallowHeapAllocation scope out of this function.
+
+  // Write the allocated filler object into the dispatch table. It will be
+  // returned by our custom Allocate method below once needed. The entry is
+  // overwritten with the final code->entry() value by the caller.
+
+  Address* dispatch_table = isolate()->interpreter()->dispatch_table_;
+  const size_t index =
+      Interpreter::GetDispatchTableIndex(bytecode, operand_scale);
+  dispatch_table[index] = o->address();
+
+#ifdef DEBUG
+  RegisterCodeObjectReservation(code_object_id);
+#endif
+}
+
 #ifdef DEBUG
 void BuiltinDeserializerAllocator::RegisterCodeObjectReservation(
     int code_object_id) {
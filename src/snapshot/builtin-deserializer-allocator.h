@@ -69,6 +69,11 @@ class BuiltinDeserializerAllocator final {
   // lazily deserializing a single builtin.
   void ReserveAndInitializeBuiltinsTableForBuiltin(int builtin_id);
 
+  // Pre-allocates a code object in preparation for lazily deserializing a
+  // single bytecode handler.
+  void ReserveForHandler(interpreter::Bytecode bytecode,
+                         interpreter::OperandScale operand_scale);
+
 #ifdef DEBUG
   bool ReservationsAreFullyUsed() const;
 #endif
@@ -77,17 +77,22 @@ void BuiltinDeserializer::DeserializeEagerBuiltinsAndHandlers() {
 
   // Deserialize bytecode handlers.
 
-  // The dispatch table has been initialized during memory reservation.
+  // Dispatch table entries for eager handlers have been initialized during
+  // memory reservation. Entries for lazy handlers are still unset and are
+  // filled in below with the DeserializeLazy handlers, which at this point
+  // have been deserialized as part of the startup snapshot's root set.
   Interpreter* interpreter = isolate()->interpreter();
-  DCHECK(isolate()->interpreter()->IsDispatchTableInitialized());
 
   BSU::ForEachBytecode([=](Bytecode bytecode, OperandScale operand_scale) {
-    // TODO (jgruber): Replace with DeserializeLazy handler. id:1373 gh:1381
-
     // Bytecodes without a dedicated handler are patched up in a second pass.
     if (!BSU::BytecodeHasDedicatedHandler(bytecode, operand_scale)) return;
 
-    Code* code = DeserializeHandlerRaw(bytecode, operand_scale);
+    // If lazy handler deserialization is enabled, we replace the handler by
+    // the DeserializeLazy handler and deserialize later upon first use.
+    Code* code = IsLazyHandler(bytecode)
+                     ? GetDeserializeLazyHandler(operand_scale)
+                     : DeserializeHandlerRaw(bytecode, operand_scale);
+
     interpreter->SetBytecodeHandler(bytecode, operand_scale, code);
   });
 
@@ -123,6 +128,13 @@ Code* BuiltinDeserializer::DeserializeBuiltin(int builtin_id) {
   return DeserializeBuiltinRaw(builtin_id);
 }
 
+Code* BuiltinDeserializer::DeserializeHandler(Bytecode bytecode,
+                                              OperandScale operand_scale) {
+  allocator()->ReserveForHandler(bytecode, operand_scale);
+  DisallowHeapAllocation no_gc;
+  return DeserializeHandlerRaw(bytecode, operand_scale);
+}
+
 Code* BuiltinDeserializer::DeserializeBuiltinRaw(int builtin_id) {
   DCHECK(!AllowHeapAllocation::IsAllowed());
   DCHECK(Builtins::IsBuiltinId(builtin_id));
@@ -171,6 +183,28 @@ Code* BuiltinDeserializer::DeserializeHandlerRaw(Bytecode bytecode,
   return code;
 }
 
+bool BuiltinDeserializer::IsLazyHandler(Bytecode bytecode) const {
+  // The Illegal handler is always deserialized eagerly: besides handling the
+  // kIllegal bytecode, it is used to patch up dispatch table entries of
+  // bytecodes without their own handler.
+  return FLAG_lazy_handler_deserialization && IsLazyDeserializationEnabled() &&
+         bytecode != Bytecode::kIllegal;
+}
+
+Code* BuiltinDeserializer::GetDeserializeLazyHandler(
+    OperandScale operand_scale) const {
+  Heap* heap = isolate()->heap();
+  switch (operand_scale) {
+    case OperandScale::kSingle:
+      return Code::cast(heap->deserialize_lazy_handler());
+    case OperandScale::kDouble:
+      return Code::cast(heap->deserialize_lazy_handler_wide());
+    case OperandScale::kQuadruple:
+      return Code::cast(heap->deserialize_lazy_handler_extra_wide());
+  }
+  UNREACHABLE();
+}
+
 uint32_t BuiltinDeserializer::ExtractCodeObjectSize(int code_object_id) {
   DCHECK_LT(code_object_id, BSU::kNumberOfCodeObjects);
 
@@ -36,6 +36,11 @@ class BuiltinDeserializer final
   // lazily deserialized at runtime.
   Code* DeserializeBuiltin(int builtin_id);
 
+  // Deserializes the single given bytecode handler. This is used whenever a
+  // handler is lazily deserialized at runtime.
+  Code* DeserializeHandler(interpreter::Bytecode bytecode,
+                           interpreter::OperandScale operand_scale);
+
  private:
   // Deserializes the single given builtin. Assumes that reservations have
   // already been allocated.
@@ -46,6 +51,16 @@ class BuiltinDeserializer final
   Code* DeserializeHandlerRaw(interpreter::Bytecode bytecode,
                               interpreter::OperandScale operand_scale);
 
+  // Returns whether the given bytecode handler is deserialized lazily, i.e.
+  // on first use instead of eagerly during startup.
+  bool IsLazyHandler(interpreter::Bytecode bytecode) const;
+
+  // Returns the DeserializeLazy handler for the given operand scale. These
+  // handlers are stored as heap roots and are deserialized as part of the
+  // startup snapshot.
+  Code* GetDeserializeLazyHandler(
+      interpreter::OperandScale operand_scale) const;
+
   // Extracts the size builtin Code objects (baked into the snapshot).
   uint32_t ExtractCodeObjectSize(int builtin_id);
 
@@ -72,8 +87,8 @@ class BuiltinDeserializer final
   // For current_code_object_id_.
   friend class DeserializingCodeObjectScope;
 
-  // For isolate(), IsLazyDeserializationEnabled(), CurrentCodeObjectId() and
-  // ExtractBuiltinSize().
+  // For isolate(), IsLazyDeserializationEnabled(), IsLazyHandler(),
+  // CurrentCodeObjectId() and ExtractBuiltinSize().
   friend class BuiltinDeserializerAllocator;
 };
 
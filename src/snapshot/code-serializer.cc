@@ -5,9 +5,13 @@
 #include "src/snapshot/code-serializer.h"
 
 #include <memory>
+#include <unordered_set>
 
+#include "src/base/functional.h"
 #include "src/code-stubs.h"
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
 #include "src/counters.h"
+#include "src/external-reference-table.h"
 #include "src/log.h"
 #include "src/macro-assembler.h"
 #include "src/objects-inl.h"
@@ -23,7 +27,8 @@ namespace internal {
 
 ScriptData* CodeSerializer::Serialize(Isolate* isolate,
                                       Handle<SharedFunctionInfo> info,
-                                      Handle<String> source) {
+                                      Handle<String> source,
+                                      const ScriptData* base_cache) {
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization) timer.Start();
   if (FLAG_trace_serializer) {
@@ -33,8 +38,42 @@ ScriptData* CodeSerializer::Serialize(Isolate* isolate,
     PrintF("]\n");
   }
 
+  Handle<Script> script(Script::cast(info->script()), isolate);
+  uint32_t compilation_state_hash =
+      SerializedCodeData::CompilationStateHash(isolate, script);
+
+  // If the base cache was produced from the same source and compilation
+  // state, serializing would reproduce it byte for byte. Hand out a copy
+  // instead of re-serializing the entire object graph.
+  if (base_cache != nullptr &&
+      SerializedCodeData::IsUpToDate(isolate, base_cache, source,
+                                     compilation_state_hash)) {
+    byte* copy = NewArray<byte>(base_cache->length());
+    CopyBytes(copy, base_cache->data(),
+              static_cast<size_t>(base_cache->length()));
+    ScriptData* ret = new ScriptData(copy, base_cache->length());
+    ret->AcquireDataOwnership();
+
+    if (FLAG_profile_deserialization) {
+      double ms = timer.Elapsed().InMillisecondsF();
+      PrintF("[Reusing base code cache (%d bytes) took %0.3f ms]\n",
+             ret->length(), ms);
+    }
+    return ret;
+  }
+
   // Serialize code object.
-  CodeSerializer cs(isolate, SerializedCodeData::SourceHash(source));
+  CodeSerializer cs(isolate, SerializedCodeData::SourceHash(source),
+                    compilation_state_hash);
+  if (FLAG_compile_ahead) {
+    const std::vector<int>* profile =
+        isolate->LazyCompilationProfile(script->id());
+    if (profile != nullptr) {
+      for (int id : *profile) {
+        cs.compile_ahead_ids_.push_back(static_cast<uint32_t>(id));
+      }
+    }
+  }
   DisallowHeapAllocation no_gc;
   cs.reference_map()->AddAttachedReference(*source);
   ScriptData* ret = cs.Serialize(info);
@@ -159,6 +198,34 @@ void CodeSerializer::SerializeCodeStub(Code* code_stub, HowToCode how_to_code,
   PutAttachedReference(reference, how_to_code, where_to_point);
 }
 
+namespace {
+
+// Enqueues the not-yet-compiled functions listed in the cache to the
+// compiler dispatcher, so that they are likely compiled before their first
+// call (see Isolate::RecordLazyCompilation).
+void EnqueueCompileAheadFunctions(Isolate* isolate, Handle<Script> script,
+                                  Vector<const uint32_t> compile_ahead_ids) {
+  CompilerDispatcher* dispatcher = isolate->compiler_dispatcher();
+  if (!dispatcher->IsEnabled()) return;
+  std::unordered_set<uint32_t> ids(
+      compile_ahead_ids.start(),
+      compile_ahead_ids.start() + compile_ahead_ids.length());
+  SharedFunctionInfo::ScriptIterator iterator(
+      isolate, handle(script->shared_function_infos()));
+  while (SharedFunctionInfo* info = iterator.Next()) {
+    if (info->is_compiled()) continue;
+    if (ids.count(static_cast<uint32_t>(info->function_literal_id())) == 0) {
+      continue;
+    }
+    Handle<SharedFunctionInfo> shared(info, isolate);
+    // Enqueueing may fail, e.g. for functions the dispatcher cannot compile;
+    // those simply stay lazy.
+    dispatcher->Enqueue(shared);
+  }
+}
+
+}  // namespace
+
 MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     Isolate* isolate, ScriptData* cached_data, Handle<String> source) {
   base::ElapsedTimer timer;
@@ -196,6 +263,15 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     PrintF("[Deserializing from %d bytes took %0.3f ms]\n", length, ms);
   }
 
+  if (FLAG_compile_ahead && result->script()->IsScript()) {
+    Vector<const uint32_t> compile_ahead_ids = scd.CompileAheadIds();
+    if (compile_ahead_ids.length() > 0) {
+      EnqueueCompileAheadFunctions(
+          isolate, handle(Script::cast(result->script()), isolate),
+          compile_ahead_ids);
+    }
+  }
+
   if (isolate->logger()->is_logging_code_events() || isolate->is_profiling()) {
     String* name = isolate->heap()->empty_string();
     if (result->script()->IsScript()) {
@@ -211,7 +287,7 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
 WasmCompiledModuleSerializer::WasmCompiledModuleSerializer(
     Isolate* isolate, uint32_t source_hash, Handle<Context> native_context,
     Handle<SeqOneByteString> module_bytes)
-    : CodeSerializer(isolate, source_hash) {
+    : CodeSerializer(isolate, source_hash, 0) {
   reference_map()->AddAttachedReference(*isolate->native_context());
   reference_map()->AddAttachedReference(*module_bytes);
 }
@@ -333,6 +409,7 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
                                        const CodeSerializer* cs) {
   DisallowHeapAllocation no_gc;
   const std::vector<uint32_t>* stub_keys = cs->stub_keys();
+  const std::vector<uint32_t>* compile_ahead_ids = cs->compile_ahead_ids();
   std::vector<Reservation> reservations = cs->EncodeReservations();
 
   // Calculate sizes.
@@ -340,7 +417,11 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
       static_cast<uint32_t>(reservations.size()) * kUInt32Size;
   uint32_t num_stub_keys = static_cast<uint32_t>(stub_keys->size());
   uint32_t stub_keys_size = num_stub_keys * kUInt32Size;
-  uint32_t payload_offset = kHeaderSize + reservation_size + stub_keys_size;
+  uint32_t num_compile_ahead_ids =
+      static_cast<uint32_t>(compile_ahead_ids->size());
+  uint32_t compile_ahead_ids_size = num_compile_ahead_ids * kUInt32Size;
+  uint32_t payload_offset =
+      kHeaderSize + reservation_size + stub_keys_size + compile_ahead_ids_size;
   uint32_t padded_payload_offset = POINTER_SIZE_ALIGN(payload_offset);
   uint32_t size =
       padded_payload_offset + static_cast<uint32_t>(payload->size());
@@ -355,9 +436,11 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
   SetHeaderValue(kCpuFeaturesOffset,
                  static_cast<uint32_t>(CpuFeatures::SupportedFeatures()));
   SetHeaderValue(kFlagHashOffset, FlagList::Hash());
+  SetHeaderValue(kCompilationStateHashOffset, cs->compilation_state_hash());
   SetHeaderValue(kNumReservationsOffset,
                  static_cast<uint32_t>(reservations.size()));
   SetHeaderValue(kNumCodeStubKeysOffset, num_stub_keys);
+  SetHeaderValue(kNumCompileAheadIdsOffset, num_compile_ahead_ids);
   SetHeaderValue(kPayloadLengthOffset, static_cast<uint32_t>(payload->size()));
 
   // Zero out any padding in the header.
@@ -372,6 +455,11 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
   CopyBytes(data_ + kHeaderSize + reservation_size,
             reinterpret_cast<const byte*>(stub_keys->data()), stub_keys_size);
 
+  // Copy compile-ahead function ids.
+  CopyBytes(data_ + kHeaderSize + reservation_size + stub_keys_size,
+            reinterpret_cast<const byte*>(compile_ahead_ids->data()),
+            compile_ahead_ids_size);
+
   // Zero out any padding before the payload.
   memset(data_ + payload_offset, 0, padded_payload_offset - payload_offset);
 
@@ -386,36 +474,83 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
 
 SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
     Isolate* isolate, uint32_t expected_source_hash) const {
+  SanityCheckResult result = SanityCheckWithoutSource(
+      ComputeMagicNumber(isolate));
+  if (result != CHECK_SUCCESS) return result;
+  uint32_t source_hash = GetHeaderValue(kSourceHashOffset);
+  if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
+  return CHECK_SUCCESS;
+}
+
+SerializedCodeData::SanityCheckResult
+SerializedCodeData::SanityCheckWithoutSource(
+    uint32_t expected_magic_number) const {
   if (this->size_ < kHeaderSize) return INVALID_HEADER;
   uint32_t magic_number = GetMagicNumber();
-  if (magic_number != ComputeMagicNumber(isolate)) return MAGIC_NUMBER_MISMATCH;
+  if (magic_number != expected_magic_number) return MAGIC_NUMBER_MISMATCH;
   uint32_t version_hash = GetHeaderValue(kVersionHashOffset);
-  uint32_t source_hash = GetHeaderValue(kSourceHashOffset);
   uint32_t cpu_features = GetHeaderValue(kCpuFeaturesOffset);
   uint32_t flags_hash = GetHeaderValue(kFlagHashOffset);
   uint32_t payload_length = GetHeaderValue(kPayloadLengthOffset);
   uint32_t c1 = GetHeaderValue(kChecksum1Offset);
   uint32_t c2 = GetHeaderValue(kChecksum2Offset);
   if (version_hash != Version::Hash()) return VERSION_MISMATCH;
-  if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
   if (cpu_features != static_cast<uint32_t>(CpuFeatures::SupportedFeatures())) {
     return CPU_FEATURES_MISMATCH;
   }
   if (flags_hash != FlagList::Hash()) return FLAGS_MISMATCH;
   uint32_t max_payload_length =
       this->size_ -
-      POINTER_SIZE_ALIGN(kHeaderSize +
-                         GetHeaderValue(kNumReservationsOffset) * kInt32Size +
-                         GetHeaderValue(kNumCodeStubKeysOffset) * kInt32Size);
+      POINTER_SIZE_ALIGN(
+          kHeaderSize + GetHeaderValue(kNumReservationsOffset) * kInt32Size +
+          GetHeaderValue(kNumCodeStubKeysOffset) * kInt32Size +
+          GetHeaderValue(kNumCompileAheadIdsOffset) * kInt32Size);
   if (payload_length > max_payload_length) return LENGTH_MISMATCH;
   if (!Checksum(DataWithoutHeader()).Check(c1, c2)) return CHECKSUM_MISMATCH;
   return CHECK_SUCCESS;
 }
 
+// static
+SerializedCodeData::SanityCheckResult SerializedCodeData::CheckWithoutSource(
+    const byte* data, int length, uint32_t expected_magic_number) {
+  return SerializedCodeData(data, length)
+      .SanityCheckWithoutSource(expected_magic_number);
+}
+
 uint32_t SerializedCodeData::SourceHash(Handle<String> source) {
   return source->length();
 }
 
+// static
+uint32_t SerializedCodeData::CompilationStateHash(Isolate* isolate,
+                                                  Handle<Script> script) {
+  size_t hash = 0;
+  SharedFunctionInfo::ScriptIterator iterator(
+      isolate, handle(script->shared_function_infos()));
+  while (SharedFunctionInfo* info = iterator.Next()) {
+    uint32_t entry = static_cast<uint32_t>(info->function_literal_id()) << 1;
+    if (info->HasBytecodeArray()) {
+      entry =
+          (entry | 1) ^ static_cast<uint32_t>(info->bytecode_array()->length());
+    }
+    hash = base::hash_combine(hash, entry);
+  }
+  return static_cast<uint32_t>(hash);
+}
+
+// static
+bool SerializedCodeData::IsUpToDate(Isolate* isolate,
+                                    const ScriptData* base_cache,
+                                    Handle<String> source,
+                                    uint32_t expected_compilation_state_hash) {
+  SerializedCodeData scd(base_cache->data(), base_cache->length());
+  if (scd.SanityCheck(isolate, SourceHash(source)) != CHECK_SUCCESS) {
+    return false;
+  }
+  return scd.GetHeaderValue(kCompilationStateHashOffset) ==
+         expected_compilation_state_hash;
+}
+
 // Return ScriptData object and relinquish ownership over it to the caller.
 ScriptData* SerializedCodeData::GetScriptData() {
   DCHECK(owns_data_);
@@ -436,7 +571,10 @@ Vector<const SerializedData::Reservation> SerializedCodeData::Reservations()
 Vector<const byte> SerializedCodeData::Payload() const {
   int reservations_size = GetHeaderValue(kNumReservationsOffset) * kInt32Size;
   int code_stubs_size = GetHeaderValue(kNumCodeStubKeysOffset) * kInt32Size;
-  int payload_offset = kHeaderSize + reservations_size + code_stubs_size;
+  int compile_ahead_ids_size =
+      GetHeaderValue(kNumCompileAheadIdsOffset) * kInt32Size;
+  int payload_offset = kHeaderSize + reservations_size + code_stubs_size +
+                       compile_ahead_ids_size;
   int padded_payload_offset = POINTER_SIZE_ALIGN(payload_offset);
   const byte* payload = data_ + padded_payload_offset;
   DCHECK(IsAligned(reinterpret_cast<intptr_t>(payload), kPointerAlignment));
@@ -452,6 +590,15 @@ Vector<const uint32_t> SerializedCodeData::CodeStubKeys() const {
                                 GetHeaderValue(kNumCodeStubKeysOffset));
 }
 
+Vector<const uint32_t> SerializedCodeData::CompileAheadIds() const {
+  int reservations_size = GetHeaderValue(kNumReservationsOffset) * kInt32Size;
+  int code_stubs_size = GetHeaderValue(kNumCodeStubKeysOffset) * kInt32Size;
+  const byte* start =
+      data_ + kHeaderSize + reservations_size + code_stubs_size;
+  return Vector<const uint32_t>(reinterpret_cast<const uint32_t*>(start),
+                                GetHeaderValue(kNumCompileAheadIdsOffset));
+}
+
 SerializedCodeData::SerializedCodeData(ScriptData* data)
     : SerializedData(const_cast<byte*>(data->data()), data->length()) {}
 
@@ -460,7 +607,17 @@ SerializedCodeData SerializedCodeData::FromCachedData(
     SanityCheckResult* rejection_result) {
   DisallowHeapAllocation no_gc;
   SerializedCodeData scd(cached_data);
-  *rejection_result = scd.SanityCheck(isolate, expected_source_hash);
+  if (cached_data->background_checked()) {
+    // A background CodeCacheConsumptionTask already performed all the
+    // source-independent checks including the payload checksum; only the
+    // source hash remains to be matched.
+    *rejection_result =
+        scd.GetHeaderValue(kSourceHashOffset) == expected_source_hash
+            ? CHECK_SUCCESS
+            : SOURCE_MISMATCH;
+  } else {
+    *rejection_result = scd.SanityCheck(isolate, expected_source_hash);
+  }
   if (*rejection_result != CHECK_SUCCESS) {
     cached_data->Reject();
     return SerializedCodeData(nullptr, 0);
@@ -468,5 +625,18 @@ SerializedCodeData SerializedCodeData::FromCachedData(
   return scd;
 }
 
+BackgroundCodeCacheCheckTask::BackgroundCodeCacheCheckTask(
+    Isolate* isolate, const v8::ScriptCompiler::CachedData* cached_data)
+    : data_(cached_data->data),
+      length_(cached_data->length),
+      expected_magic_number_(SerializedData::ComputeMagicNumber(
+          ExternalReferenceTable::instance(isolate))),
+      result_(SerializedCodeData::INVALID_HEADER) {}
+
+void BackgroundCodeCacheCheckTask::Run() {
+  result_ = SerializedCodeData::CheckWithoutSource(data_, length_,
+                                                   expected_magic_number_);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,7 @@
 #ifndef V8_SNAPSHOT_CODE_SERIALIZER_H_
 #define V8_SNAPSHOT_CODE_SERIALIZER_H_
 
+#include "include/v8.h"
 #include "src/parsing/preparse-data.h"
 #include "src/snapshot/serializer.h"
 
@@ -13,9 +14,14 @@ namespace internal {
 
 class CodeSerializer : public Serializer<> {
  public:
+  // Serializes the given toplevel function. If |base_cache| is non-null and
+  // records the same source and compilation state as the data about to be
+  // serialized, a copy of |base_cache| is returned instead of re-serializing
+  // the entire object graph.
   static ScriptData* Serialize(Isolate* isolate,
                                Handle<SharedFunctionInfo> info,
-                               Handle<String> source);
+                               Handle<String> source,
+                               const ScriptData* base_cache = nullptr);
 
   ScriptData* Serialize(Handle<HeapObject> obj);
 
@@ -24,11 +30,22 @@ class CodeSerializer : public Serializer<> {
 
   const std::vector<uint32_t>* stub_keys() const { return &stub_keys_; }
 
+  // Function literal ids recorded for compile-ahead (see
+  // Isolate::RecordLazyCompilation), to be included in the cache.
+  const std::vector<uint32_t>* compile_ahead_ids() const {
+    return &compile_ahead_ids_;
+  }
+
   uint32_t source_hash() const { return source_hash_; }
 
+  uint32_t compilation_state_hash() const { return compilation_state_hash_; }
+
  protected:
-  explicit CodeSerializer(Isolate* isolate, uint32_t source_hash)
-      : Serializer(isolate), source_hash_(source_hash) {}
+  CodeSerializer(Isolate* isolate, uint32_t source_hash,
+                 uint32_t compilation_state_hash)
+      : Serializer(isolate),
+        source_hash_(source_hash),
+        compilation_state_hash_(compilation_state_hash) {}
   ~CodeSerializer() override { OutputStatistics("CodeSerializer"); }
 
   virtual void SerializeCodeObject(Code* code_object, HowToCode how_to_code,
@@ -49,7 +66,9 @@ class CodeSerializer : public Serializer<> {
 
   DisallowHeapAllocation no_gc_;
   uint32_t source_hash_;
+  uint32_t compilation_state_hash_;
   std::vector<uint32_t> stub_keys_;
+  std::vector<uint32_t> compile_ahead_ids_;
   DISALLOW_COPY_AND_ASSIGN(CodeSerializer);
 };
 
@@ -94,23 +113,31 @@ class SerializedCodeData : public SerializedData {
   // [3] source hash
   // [4] cpu features
   // [5] flag hash
-  // [6] number of code stub keys
+  // [6] compilation state hash
   // [7] number of reservation size entries
-  // [8] payload length
-  // [9] payload checksum part 1
-  // [10] payload checksum part 2
+  // [8] number of code stub keys
+  // [9] number of compile-ahead function ids
+  // [10] payload length
+  // [11] payload checksum part 1
+  // [12] payload checksum part 2
   // ...  reservations
   // ...  code stub keys
+  // ...  compile-ahead function ids
   // ...  serialized payload
   static const uint32_t kVersionHashOffset = kMagicNumberOffset + kUInt32Size;
   static const uint32_t kSourceHashOffset = kVersionHashOffset + kUInt32Size;
   static const uint32_t kCpuFeaturesOffset = kSourceHashOffset + kUInt32Size;
   static const uint32_t kFlagHashOffset = kCpuFeaturesOffset + kUInt32Size;
-  static const uint32_t kNumReservationsOffset = kFlagHashOffset + kUInt32Size;
+  static const uint32_t kCompilationStateHashOffset =
+      kFlagHashOffset + kUInt32Size;
+  static const uint32_t kNumReservationsOffset =
+      kCompilationStateHashOffset + kUInt32Size;
   static const uint32_t kNumCodeStubKeysOffset =
       kNumReservationsOffset + kUInt32Size;
-  static const uint32_t kPayloadLengthOffset =
+  static const uint32_t kNumCompileAheadIdsOffset =
       kNumCodeStubKeysOffset + kUInt32Size;
+  static const uint32_t kPayloadLengthOffset =
+      kNumCompileAheadIdsOffset + kUInt32Size;
   static const uint32_t kChecksum1Offset = kPayloadLengthOffset + kUInt32Size;
   static const uint32_t kChecksum2Offset = kChecksum1Offset + kUInt32Size;
   static const uint32_t kUnalignedHeaderSize = kChecksum2Offset + kUInt32Size;
@@ -122,6 +149,13 @@ class SerializedCodeData : public SerializedData {
                                            uint32_t expected_source_hash,
                                            SanityCheckResult* rejection_result);
 
+  // Performs all source-independent sanity checks, including the payload
+  // checksum. Does not touch the isolate's heap and can be called from any
+  // thread; the expected magic number must be computed up front on the main
+  // thread.
+  static SanityCheckResult CheckWithoutSource(const byte* data, int length,
+                                              uint32_t expected_magic_number);
+
   // Used when producing.
   SerializedCodeData(const std::vector<byte>* payload,
                      const CodeSerializer* cs);
@@ -134,8 +168,25 @@ class SerializedCodeData : public SerializedData {
 
   Vector<const uint32_t> CodeStubKeys() const;
 
+  // Function literal ids of functions that were compiled lazily when the
+  // cache was produced; candidates for compile-ahead on consumption.
+  Vector<const uint32_t> CompileAheadIds() const;
+
   static uint32_t SourceHash(Handle<String> source);
 
+  // Hashes the compilation state of all functions belonging to |script|:
+  // which functions are compiled, and the sizes of their bytecode. Two caches
+  // produced from the same source with equal hashes contain the same set of
+  // compiled functions.
+  static uint32_t CompilationStateHash(Isolate* isolate, Handle<Script> script);
+
+  // Returns true if |base_cache| is a valid cache for |source| and records
+  // the given compilation state hash, i.e. re-serializing would reproduce the
+  // same set of compiled functions.
+  static bool IsUpToDate(Isolate* isolate, const ScriptData* base_cache,
+                         Handle<String> source,
+                         uint32_t expected_compilation_state_hash);
+
  private:
   explicit SerializedCodeData(ScriptData* data);
   SerializedCodeData(const byte* data, int size)
@@ -147,6 +198,35 @@ class SerializedCodeData : public SerializedData {
 
   SanityCheckResult SanityCheck(Isolate* isolate,
                                 uint32_t expected_source_hash) const;
+  SanityCheckResult SanityCheckWithoutSource(
+      uint32_t expected_magic_number) const;
+};
+
+// Validates the source-independent parts of a code cache entry (header
+// fields and payload checksum) on a background thread, mirroring how
+// BackgroundParsingTask prepares streamed source off the main thread. The
+// main-thread consume step then only needs to match the source hash and
+// deserialize.
+class BackgroundCodeCacheCheckTask
+    : public v8::ScriptCompiler::CodeCacheConsumptionTask {
+ public:
+  BackgroundCodeCacheCheckTask(
+      Isolate* isolate, const v8::ScriptCompiler::CachedData* cached_data);
+
+  void Run() override;
+
+  const byte* data() const { return data_; }
+  bool checks_passed() const {
+    return result_ == SerializedCodeData::CHECK_SUCCESS;
+  }
+
+ private:
+  const byte* data_;
+  int length_;
+  uint32_t expected_magic_number_;
+  SerializedCodeData::SanityCheckResult result_;
+
+  DISALLOW_COPY_AND_ASSIGN(BackgroundCodeCacheCheckTask);
 };
 
 }  // namespace internal
@@ -7,11 +7,15 @@
 #include "src/snapshot/snapshot.h"
 
 #include "src/api.h"
+#include "src/base/functional.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/heap/item-parallel-job.h"
 #include "src/objects-inl.h"
 #include "src/snapshot/builtin-deserializer.h"
 #include "src/snapshot/builtin-serializer.h"
 #include "src/snapshot/partial-deserializer.h"
+#include "src/snapshot/snapshot-compression.h"
 #include "src/snapshot/snapshot-source-sink.h"
 #include "src/snapshot/startup-deserializer.h"
 #include "src/utils.h"
@@ -20,6 +24,91 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Decompressed startup and context sections of a snapshot blob, shared by all
+// isolates in the process. Isolates deserialize directly from this single
+// mapping instead of each producing (and temporarily keeping) their own
+// decompressed copy. Sections are kept until process exit; the process
+// typically only ever uses a single blob, so the list has one entry.
+struct SharedSnapshotSections {
+  const v8::StartupData* blob;
+  std::vector<byte> startup;
+  std::vector<std::vector<byte>> contexts;
+  SharedSnapshotSections* next;
+};
+
+base::LazyMutex shared_snapshot_sections_mutex = LAZY_MUTEX_INITIALIZER;
+SharedSnapshotSections* shared_snapshot_sections_head = nullptr;
+
+SharedSnapshotSections* GetSharedSnapshotSections(const v8::StartupData* blob,
+                                                  uint32_t num_contexts) {
+  for (SharedSnapshotSections* sections = shared_snapshot_sections_head;
+       sections != nullptr; sections = sections->next) {
+    if (sections->blob == blob) return sections;
+  }
+  SharedSnapshotSections* sections = new SharedSnapshotSections;
+  sections->blob = blob;
+  sections->contexts.resize(num_contexts);
+  sections->next = shared_snapshot_sections_head;
+  shared_snapshot_sections_head = sections;
+  return sections;
+}
+
+Vector<const byte> ToConstVector(const std::vector<byte>& data) {
+  return Vector<const byte>(data.data(), static_cast<int>(data.size()));
+}
+
+std::vector<Vector<const byte>> SplitIntoPages(Vector<const byte> payload,
+                                               uint32_t page_size) {
+  std::vector<Vector<const byte>> pages;
+  for (int offset = 0; offset < payload.length();
+       offset += static_cast<int>(page_size)) {
+    int length =
+        Min(payload.length() - offset, static_cast<int>(page_size));
+    pages.push_back(payload.SubVector(offset, offset + length));
+  }
+  return pages;
+}
+
+// A single page of the snapshot payload to be checksummed. Pages are
+// independent of each other and can be processed in parallel; the per-page
+// checksums are combined in page order afterwards.
+class ChecksumPageItem final : public ItemParallelJob::Item {
+ public:
+  explicit ChecksumPageItem(Vector<const byte> page) : page_(page) {}
+
+  void Process() {
+    Checksum checksum(page_);
+    a_ = checksum.a();
+    b_ = checksum.b();
+  }
+
+  uint32_t a() const { return a_; }
+  uint32_t b() const { return b_; }
+
+ private:
+  Vector<const byte> page_;
+  uint32_t a_ = 0;
+  uint32_t b_ = 0;
+};
+
+class ChecksumPageTask final : public ItemParallelJob::Task {
+ public:
+  explicit ChecksumPageTask(Isolate* isolate)
+      : ItemParallelJob::Task(isolate) {}
+
+  void RunInParallel() override {
+    ChecksumPageItem* item;
+    while ((item = GetItem<ChecksumPageItem>()) != nullptr) {
+      item->Process();
+      item->MarkFinished();
+    }
+  }
+};
+
+}  // namespace
+
 #ifdef DEBUG
 bool Snapshot::SnapshotIsValid(const v8::StartupData* snapshot_blob) {
   return Snapshot::ExtractNumContexts(snapshot_blob) > 0;
@@ -42,7 +131,10 @@ bool Snapshot::Initialize(Isolate* isolate) {
 
   const v8::StartupData* blob = isolate->snapshot_blob();
   CheckVersion(blob);
-  Vector<const byte> startup_data = ExtractStartupData(blob);
+  if (FLAG_verify_snapshot_checksum) CHECK(VerifyChecksum(isolate, blob));
+  Vector<const byte> startup_data = ExtractCompressionFlag(blob)
+                                        ? DecompressedStartupData(blob)
+                                        : ExtractStartupData(blob);
   SnapshotData startup_snapshot_data(startup_data);
   Vector<const byte> builtin_data = ExtractBuiltinData(blob);
   BuiltinSnapshotData builtin_snapshot_data(builtin_data);
@@ -68,7 +160,9 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
   const v8::StartupData* blob = isolate->snapshot_blob();
   bool can_rehash = ExtractRehashability(blob);
   Vector<const byte> context_data =
-      ExtractContextData(blob, static_cast<uint32_t>(context_index));
+      ExtractCompressionFlag(blob)
+          ? DecompressedContextData(blob, static_cast<uint32_t>(context_index))
+          : ExtractContextData(blob, static_cast<uint32_t>(context_index));
   SnapshotData snapshot_data(context_data);
 
   MaybeHandle<Context> maybe_result = PartialDeserializer::DeserializeContext(
@@ -115,6 +209,36 @@ Code* Snapshot::DeserializeBuiltin(Isolate* isolate, int builtin_id) {
   return code;
 }
 
+// static
+Code* Snapshot::DeserializeHandler(Isolate* isolate,
+                                   interpreter::Bytecode bytecode,
+                                   interpreter::OperandScale operand_scale) {
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization) timer.Start();
+
+  const v8::StartupData* blob = isolate->snapshot_blob();
+  Vector<const byte> builtin_data = Snapshot::ExtractBuiltinData(blob);
+  BuiltinSnapshotData builtin_snapshot_data(builtin_data);
+
+  CodeSpaceMemoryModificationScope code_allocation(isolate->heap());
+  BuiltinDeserializer builtin_deserializer(isolate, &builtin_snapshot_data);
+  Code* code = builtin_deserializer.DeserializeHandler(bytecode, operand_scale);
+
+  if (FLAG_profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    int bytes = code->Size();
+    PrintF("[Deserializing handler %s (%d bytes) took %0.3f ms]\n",
+           interpreter::Bytecodes::ToString(bytecode, operand_scale).c_str(),
+           bytes, ms);
+  }
+
+  if (isolate->logger()->is_logging_code_events() || isolate->is_profiling()) {
+    isolate->logger()->LogCodeObject(code);
+  }
+
+  return code;
+}
+
 void ProfileDeserialization(
     const SnapshotData* startup_snapshot, const SnapshotData* builtin_snapshot,
     const std::vector<SnapshotData*>& context_snapshots) {
@@ -144,30 +268,56 @@ v8::StartupData Snapshot::CreateSnapshotBlob(
     const std::vector<SnapshotData*>& context_snapshots, bool can_be_rehashed) {
   uint32_t num_contexts = static_cast<uint32_t>(context_snapshots.size());
   uint32_t startup_snapshot_offset = StartupSnapshotOffset(num_contexts);
+
+  // The startup and context sections are optionally compressed; the builtin
+  // section is not, since builtins are lazily deserialized at runtime and
+  // need cheap random access into their section.
+  Vector<const byte> startup_data = startup_snapshot->RawData();
+  std::vector<byte> compressed_startup;
+  std::vector<Vector<const byte>> context_data(num_contexts);
+  std::vector<std::vector<byte>> compressed_contexts(num_contexts);
+  for (uint32_t i = 0; i < num_contexts; i++) {
+    context_data[i] = context_snapshots[i]->RawData();
+  }
+  if (FLAG_compress_snapshot) {
+    compressed_startup = SnapshotCompression::Compress(startup_data);
+    startup_data =
+        Vector<const byte>(compressed_startup.data(),
+                           static_cast<int>(compressed_startup.size()));
+    for (uint32_t i = 0; i < num_contexts; i++) {
+      compressed_contexts[i] = SnapshotCompression::Compress(context_data[i]);
+      context_data[i] =
+          Vector<const byte>(compressed_contexts[i].data(),
+                             static_cast<int>(compressed_contexts[i].size()));
+    }
+  }
+
   uint32_t total_length = startup_snapshot_offset;
-  total_length += static_cast<uint32_t>(startup_snapshot->RawData().length());
+  total_length += static_cast<uint32_t>(startup_data.length());
   total_length += static_cast<uint32_t>(builtin_snapshot->RawData().length());
-  for (const auto context_snapshot : context_snapshots) {
-    total_length += static_cast<uint32_t>(context_snapshot->RawData().length());
+  for (const auto& context : context_data) {
+    total_length += static_cast<uint32_t>(context.length());
   }
 
   ProfileDeserialization(startup_snapshot, builtin_snapshot, context_snapshots);
 
   char* data = new char[total_length];
+  // Zero out the header including the padding up to the page-aligned startup
+  // snapshot offset, so that the blob contents are deterministic.
+  memset(data, 0, startup_snapshot_offset);
   SetHeaderValue(data, kNumberOfContextsOffset, num_contexts);
   SetHeaderValue(data, kRehashabilityOffset, can_be_rehashed ? 1 : 0);
+  SetHeaderValue(data, kCompressionFlagOffset, FLAG_compress_snapshot ? 1 : 0);
 
   // Write version string into snapshot data.
-  memset(data + kVersionStringOffset, 0, kVersionStringLength);
   Version::GetString(
       Vector<char>(data + kVersionStringOffset, kVersionStringLength));
 
   // Startup snapshot (isolate-specific data).
   uint32_t payload_offset = startup_snapshot_offset;
-  uint32_t payload_length =
-      static_cast<uint32_t>(startup_snapshot->RawData().length());
+  uint32_t payload_length = static_cast<uint32_t>(startup_data.length());
   CopyBytes(data + payload_offset,
-            reinterpret_cast<const char*>(startup_snapshot->RawData().start()),
+            reinterpret_cast<const char*>(startup_data.start()),
             payload_length);
   if (FLAG_profile_deserialization) {
     PrintF("Snapshot blob consists of:\n%10d bytes for startup\n",
@@ -189,12 +339,10 @@ v8::StartupData Snapshot::CreateSnapshotBlob(
   // Partial snapshots (context-specific data).
   for (uint32_t i = 0; i < num_contexts; i++) {
     SetHeaderValue(data, ContextSnapshotOffsetOffset(i), payload_offset);
-    SnapshotData* context_snapshot = context_snapshots[i];
-    payload_length = context_snapshot->RawData().length();
-    CopyBytes(
-        data + payload_offset,
-        reinterpret_cast<const char*>(context_snapshot->RawData().start()),
-        payload_length);
+    payload_length = context_data[i].length();
+    CopyBytes(data + payload_offset,
+              reinterpret_cast<const char*>(context_data[i].start()),
+              payload_length);
     if (FLAG_profile_deserialization) {
       PrintF("%10d bytes for context #%d\n", payload_length, i);
     }
@@ -203,6 +351,7 @@ v8::StartupData Snapshot::CreateSnapshotBlob(
 
   v8::StartupData result = {data, static_cast<int>(total_length)};
   DCHECK_EQ(total_length, payload_offset);
+  SetHeaderValue(data, kChecksumOffset, CalculateChecksum(&result));
   return result;
 }
 
@@ -227,6 +376,11 @@ bool Snapshot::ExtractRehashability(const v8::StartupData* data) {
   return GetHeaderValue(data, kRehashabilityOffset) != 0;
 }
 
+bool Snapshot::ExtractCompressionFlag(const v8::StartupData* data) {
+  CHECK_LT(kCompressionFlagOffset, static_cast<uint32_t>(data->raw_size));
+  return GetHeaderValue(data, kCompressionFlagOffset) != 0;
+}
+
 Vector<const byte> Snapshot::ExtractStartupData(const v8::StartupData* data) {
   uint32_t num_contexts = ExtractNumContexts(data);
   uint32_t startup_offset = StartupSnapshotOffset(num_contexts);
@@ -276,6 +430,99 @@ Vector<const byte> Snapshot::ExtractContextData(const v8::StartupData* data,
   return Vector<const byte>(context_data, context_length);
 }
 
+Vector<const byte> Snapshot::DecompressedStartupData(
+    const v8::StartupData* data) {
+  DCHECK(ExtractCompressionFlag(data));
+  base::LockGuard<base::Mutex> lock_guard(
+      shared_snapshot_sections_mutex.Pointer());
+  SharedSnapshotSections* sections =
+      GetSharedSnapshotSections(data, ExtractNumContexts(data));
+  if (sections->startup.empty()) {
+    SnapshotCompression::Decompress(ExtractStartupData(data),
+                                    &sections->startup);
+  }
+  return ToConstVector(sections->startup);
+}
+
+Vector<const byte> Snapshot::DecompressedContextData(
+    const v8::StartupData* data, uint32_t index) {
+  DCHECK(ExtractCompressionFlag(data));
+  base::LockGuard<base::Mutex> lock_guard(
+      shared_snapshot_sections_mutex.Pointer());
+  SharedSnapshotSections* sections =
+      GetSharedSnapshotSections(data, ExtractNumContexts(data));
+  DCHECK_LT(index, sections->contexts.size());
+  std::vector<byte>& context = sections->contexts[index];
+  if (context.empty()) {
+    SnapshotCompression::Decompress(ExtractContextData(data, index), &context);
+  }
+  return ToConstVector(context);
+}
+
+Vector<const byte> SnapshotPayload(const v8::StartupData* data,
+                                   uint32_t payload_offset) {
+  CHECK_LE(payload_offset, static_cast<uint32_t>(data->raw_size));
+  return Vector<const byte>(
+      reinterpret_cast<const byte*>(data->data) + payload_offset,
+      data->raw_size - payload_offset);
+}
+
+uint32_t Snapshot::CalculateChecksum(const v8::StartupData* data) {
+  uint32_t payload_offset = StartupSnapshotOffset(ExtractNumContexts(data));
+  size_t hash = 0;
+  for (Vector<const byte> page :
+       SplitIntoPages(SnapshotPayload(data, payload_offset),
+                      kStartupSnapshotAlignment)) {
+    Checksum checksum(page);
+    hash = base::hash_combine(hash, checksum.a(), checksum.b());
+  }
+  return static_cast<uint32_t>(hash);
+}
+
+bool Snapshot::VerifyChecksum(Isolate* isolate, const v8::StartupData* data) {
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization) timer.Start();
+
+  uint32_t payload_offset = StartupSnapshotOffset(ExtractNumContexts(data));
+  std::vector<Vector<const byte>> pages = SplitIntoPages(
+      SnapshotPayload(data, payload_offset), kStartupSnapshotAlignment);
+
+  // Checksum the pages in parallel. The first task contributes on this
+  // thread; per-page checksums are combined in page order below, so the
+  // result is independent of the number of tasks.
+  base::Semaphore pending_tasks(0);
+  ItemParallelJob job(isolate->cancelable_task_manager(), &pending_tasks);
+  std::vector<ChecksumPageItem*> items;
+  items.reserve(pages.size());
+  for (Vector<const byte> page : pages) {
+    ChecksumPageItem* item = new ChecksumPageItem(page);
+    items.push_back(item);
+    job.AddItem(item);
+  }
+
+  const int num_background_threads = static_cast<int>(
+      V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads());
+  const int num_tasks =
+      Min(static_cast<int>(pages.size()), 1 + num_background_threads);
+  for (int i = 0; i < num_tasks; i++) {
+    job.AddTask(new ChecksumPageTask(isolate));
+  }
+  job.Run();
+
+  size_t hash = 0;
+  for (ChecksumPageItem* item : items) {
+    hash = base::hash_combine(hash, item->a(), item->b());
+  }
+
+  if (FLAG_profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    PrintF("[Verifying snapshot checksum (%d pages) took %0.3f ms]\n",
+           static_cast<int>(pages.size()), ms);
+  }
+
+  return static_cast<uint32_t>(hash) == GetHeaderValue(data, kChecksumOffset);
+}
+
 void Snapshot::CheckVersion(const v8::StartupData* data) {
   char version[kVersionStringLength];
   memset(version, 0, kVersionStringLength);
@@ -0,0 +1,192 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/snapshot-compression.h"
+
+#include "include/v8-platform.h"
+#include "src/base/atomic-utils.h"
+#include "src/base/platform/semaphore.h"
+#include "src/utils.h"
+#include "src/v8.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The chunk encoding is a sequence of tagged runs. A tag byte with the high
+// bit clear starts a literal run of (tag + 1) bytes which follow verbatim; a
+// tag byte with the high bit set encodes a run of ((tag & 0x7f) + 1) zero
+// bytes. Snapshot payloads contain long stretches of zeros (padding, unused
+// slots in serialized fixed arrays), which this folds away at a decompression
+// cost of essentially memcpy/memset speed.
+const byte kZeroRunTag = 0x80;
+const uint32_t kMaxRunLength = 128;
+
+void CompressChunk(const byte* input, uint32_t size, std::vector<byte>* out) {
+  uint32_t pos = 0;
+  while (pos < size) {
+    // A literal run extends up to the next zero run of length at least two;
+    // single zero bytes are cheaper to keep inside the literal run.
+    uint32_t literal_end = pos;
+    while (literal_end < size &&
+           !(input[literal_end] == 0 && literal_end + 1 < size &&
+             input[literal_end + 1] == 0)) {
+      literal_end++;
+    }
+    uint32_t literal_length = literal_end - pos;
+    while (literal_length > 0) {
+      uint32_t run = Min(literal_length, kMaxRunLength);
+      out->push_back(static_cast<byte>(run - 1));
+      out->insert(out->end(), input + pos, input + pos + run);
+      pos += run;
+      literal_length -= run;
+    }
+    uint32_t zero_end = pos;
+    while (zero_end < size && input[zero_end] == 0) zero_end++;
+    uint32_t zero_length = zero_end - pos;
+    while (zero_length > 0) {
+      uint32_t run = Min(zero_length, kMaxRunLength);
+      out->push_back(static_cast<byte>(kZeroRunTag | (run - 1)));
+      zero_length -= run;
+    }
+    pos = zero_end;
+  }
+}
+
+void DecompressChunk(const byte* input, uint32_t compressed_size, byte* output,
+                     uint32_t uncompressed_size) {
+  uint32_t in = 0;
+  uint32_t out = 0;
+  while (in < compressed_size) {
+    byte tag = input[in++];
+    uint32_t run = (tag & 0x7f) + 1;
+    CHECK_LE(out + run, uncompressed_size);
+    if (tag & kZeroRunTag) {
+      memset(output + out, 0, run);
+    } else {
+      CHECK_LE(in + run, compressed_size);
+      memcpy(output + out, input + in, run);
+      in += run;
+    }
+    out += run;
+  }
+  CHECK_EQ(out, uncompressed_size);
+}
+
+uint32_t GetUint32(Vector<const byte> data, uint32_t index) {
+  return ReadLittleEndianValue<uint32_t>(data.start() + index * kUInt32Size);
+}
+
+// Decompresses chunks claimed from a shared work list. The main thread
+// participates and waits for all helper tasks before returning, so the state
+// can live on its caller's stack.
+class DecompressionState {
+ public:
+  DecompressionState(Vector<const byte> compressed, byte* output)
+      : compressed_(compressed),
+        output_(output),
+        uncompressed_size_(GetUint32(compressed, 0)),
+        num_chunks_(GetUint32(compressed, 1)),
+        next_chunk_(0),
+        on_task_finished_(0) {
+    // Compute the payload offset of each chunk from the chunk size table.
+    chunk_offsets_.resize(num_chunks_ + 1);
+    chunk_offsets_[0] = (2 + num_chunks_) * kUInt32Size;
+    for (uint32_t i = 0; i < num_chunks_; i++) {
+      chunk_offsets_[i + 1] = chunk_offsets_[i] + GetUint32(compressed_, 2 + i);
+    }
+    CHECK_EQ(chunk_offsets_[num_chunks_],
+             static_cast<uint32_t>(compressed_.length()));
+  }
+
+  void Run() {
+    uint32_t num_tasks = 0;
+    if (num_chunks_ > 1) {
+      size_t background_threads =
+          V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads();
+      num_tasks = static_cast<uint32_t>(
+          Min<size_t>(num_chunks_ - 1, background_threads));
+    }
+    for (uint32_t i = 0; i < num_tasks; i++) {
+      V8::GetCurrentPlatform()->CallOnBackgroundThread(
+          new Task(this), v8::Platform::kShortRunningTask);
+    }
+    DecompressChunks();
+    for (uint32_t i = 0; i < num_tasks; i++) on_task_finished_.Wait();
+  }
+
+ private:
+  class Task final : public v8::Task {
+   public:
+    explicit Task(DecompressionState* state) : state_(state) {}
+    void Run() override {
+      state_->DecompressChunks();
+      state_->on_task_finished_.Signal();
+    }
+
+   private:
+    DecompressionState* const state_;
+  };
+
+  void DecompressChunks() {
+    while (true) {
+      uint32_t chunk = next_chunk_.Increment(1) - 1;
+      if (chunk >= num_chunks_) return;
+      uint32_t out_offset = chunk * SnapshotCompression::kChunkSize;
+      uint32_t out_size =
+          Min(SnapshotCompression::kChunkSize, uncompressed_size_ - out_offset);
+      DecompressChunk(compressed_.start() + chunk_offsets_[chunk],
+                      chunk_offsets_[chunk + 1] - chunk_offsets_[chunk],
+                      output_ + out_offset, out_size);
+    }
+  }
+
+  Vector<const byte> compressed_;
+  byte* const output_;
+  const uint32_t uncompressed_size_;
+  const uint32_t num_chunks_;
+  std::vector<uint32_t> chunk_offsets_;
+  base::AtomicNumber<uint32_t> next_chunk_;
+  base::Semaphore on_task_finished_;
+};
+
+}  // namespace
+
+std::vector<byte> SnapshotCompression::Compress(Vector<const byte> payload) {
+  uint32_t uncompressed_size = static_cast<uint32_t>(payload.length());
+  uint32_t num_chunks =
+      uncompressed_size == 0
+          ? 0
+          : (uncompressed_size + kChunkSize - 1) / kChunkSize;
+  std::vector<byte> result((2 + num_chunks) * kUInt32Size);
+  WriteLittleEndianValue(&result[0], uncompressed_size);
+  WriteLittleEndianValue(&result[kUInt32Size], num_chunks);
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    uint32_t in_offset = i * kChunkSize;
+    uint32_t in_size = Min(kChunkSize, uncompressed_size - in_offset);
+    size_t chunk_start = result.size();
+    CompressChunk(payload.start() + in_offset, in_size, &result);
+    WriteLittleEndianValue(&result[(2 + i) * kUInt32Size],
+                           static_cast<uint32_t>(result.size() - chunk_start));
+  }
+  return result;
+}
+
+void SnapshotCompression::Decompress(Vector<const byte> compressed,
+                                     std::vector<byte>* uncompressed) {
+  uncompressed->resize(GetUncompressedSize(compressed));
+  if (uncompressed->empty()) return;
+  DecompressionState state(compressed, uncompressed->data());
+  state.Run();
+}
+
+uint32_t SnapshotCompression::GetUncompressedSize(
+    Vector<const byte> compressed) {
+  CHECK_GE(compressed.length(), 2 * static_cast<int>(kUInt32Size));
+  return GetUint32(compressed, 0);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,47 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_SNAPSHOT_COMPRESSION_H_
+#define V8_SNAPSHOT_SNAPSHOT_COMPRESSION_H_
+
+#include <vector>
+
+#include "src/globals.h"
+#include "src/vector.h"
+
+namespace v8 {
+namespace internal {
+
+// Simple run-length based compression for snapshot blob sections. The
+// compressed stream is split into independently decodable chunks so that
+// decompression can be distributed over background threads.
+//
+// Compressed section layout:
+//   [0] uncompressed size
+//   [1] number of chunks
+//   [2] .. [2 + N - 1] compressed size of each chunk
+//   ... chunk payloads, in chunk order
+// Every chunk encodes exactly kChunkSize bytes of input, except for the last
+// one, which encodes the remainder.
+class SnapshotCompression : public AllStatic {
+ public:
+  // Amount of uncompressed input covered by a single chunk. Chosen large
+  // enough to amortize per-chunk bookkeeping, small enough that typical
+  // snapshot sections split into several chunks for parallel decompression.
+  static const uint32_t kChunkSize = 256 * KB;
+
+  static std::vector<byte> Compress(Vector<const byte> payload);
+
+  // Decompresses |compressed| into |uncompressed|, distributing chunks over
+  // background threads of the current platform when available.
+  static void Decompress(Vector<const byte> compressed,
+                         std::vector<byte>* uncompressed);
+
+  static uint32_t GetUncompressedSize(Vector<const byte> compressed);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_SNAPSHOT_COMPRESSION_H_
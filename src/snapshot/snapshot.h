@@ -5,6 +5,7 @@
 #ifndef V8_SNAPSHOT_SNAPSHOT_H_
 #define V8_SNAPSHOT_SNAPSHOT_H_
 
+#include "src/interpreter/interpreter.h"
 #include "src/snapshot/partial-serializer.h"
 #include "src/snapshot/startup-serializer.h"
 
@@ -98,6 +99,13 @@ class Snapshot : public AllStatic {
   // initialized.
   static Code* DeserializeBuiltin(Isolate* isolate, int builtin_id);
 
+  // Deserializes a single given handler code object. Intended to be called at
+  // runtime after the isolate (and the dispatch table) has been fully
+  // initialized.
+  static Code* DeserializeHandler(Isolate* isolate,
+                                  interpreter::Bytecode bytecode,
+                                  interpreter::OperandScale operand_scale);
+
   // ---------------- Helper methods ----------------
 
   static bool HasContextSnapshot(Isolate* isolate, size_t index);
@@ -123,11 +131,26 @@ class Snapshot : public AllStatic {
   static uint32_t ExtractContextOffset(const v8::StartupData* data,
                                        uint32_t index);
   static bool ExtractRehashability(const v8::StartupData* data);
+  static bool ExtractCompressionFlag(const v8::StartupData* data);
   static Vector<const byte> ExtractStartupData(const v8::StartupData* data);
   static Vector<const byte> ExtractBuiltinData(const v8::StartupData* data);
   static Vector<const byte> ExtractContextData(const v8::StartupData* data,
                                                uint32_t index);
 
+  // As above, but for compressed blobs. The decompressed sections are cached
+  // process-wide, so that all isolates deserialize from a single shared
+  // mapping instead of each decompressing their own copy.
+  static Vector<const byte> DecompressedStartupData(
+      const v8::StartupData* data);
+  static Vector<const byte> DecompressedContextData(const v8::StartupData* data,
+                                                    uint32_t index);
+
+  // The blob checksum covers the payload, i.e. everything behind the
+  // page-aligned header area. It is computed page-wise so that verification
+  // can be distributed across background threads.
+  static uint32_t CalculateChecksum(const v8::StartupData* data);
+  static bool VerifyChecksum(Isolate* isolate, const v8::StartupData* data);
+
   static uint32_t GetHeaderValue(const v8::StartupData* data, uint32_t offset) {
     return ReadLittleEndianValue<uint32_t>(data->data + offset);
   }
@@ -140,12 +163,15 @@ class Snapshot : public AllStatic {
   // Snapshot blob layout:
   // [0] number of contexts N
   // [1] rehashability
-  // [2] (128 bytes) version string
-  // [3] offset to builtins
-  // [4] offset to context 0
-  // [5] offset to context 1
+  // [2] compression flag
+  // [3] checksum
+  // [4] (64 bytes) version string
+  // [5] offset to builtins
+  // [6] offset to context 0
+  // [7] offset to context 1
   // ...
   // ... offset to context N - 1
+  // ... padding up to the next page boundary
   // ... startup snapshot data
   // ... builtin snapshot data
   // ... context 0 snapshot data
@@ -155,16 +181,25 @@ class Snapshot : public AllStatic {
   // TODO (yangguo): generalize rehashing, and remove this flag. id:1375 gh:1383
   static const uint32_t kRehashabilityOffset =
       kNumberOfContextsOffset + kUInt32Size;
-  static const uint32_t kVersionStringOffset =
+  static const uint32_t kCompressionFlagOffset =
       kRehashabilityOffset + kUInt32Size;
+  static const uint32_t kChecksumOffset = kCompressionFlagOffset + kUInt32Size;
+  static const uint32_t kVersionStringOffset = kChecksumOffset + kUInt32Size;
   static const uint32_t kVersionStringLength = 64;
   static const uint32_t kBuiltinOffsetOffset =
       kVersionStringOffset + kVersionStringLength;
   static const uint32_t kFirstContextOffsetOffset =
       kBuiltinOffsetOffset + kUInt32Size;
 
+  // The startup snapshot describes the immutable part of the heap. It is kept
+  // page-aligned within the blob so that embedders that map the blob from a
+  // file get this section on its own pages and can share it copy-on-write
+  // between processes.
+  static const uint32_t kStartupSnapshotAlignment = 4 * KB;
+
   static uint32_t StartupSnapshotOffset(int num_contexts) {
-    return kFirstContextOffsetOffset + num_contexts * kInt32Size;
+    return RoundUp(kFirstContextOffsetOffset + num_contexts * kInt32Size,
+                   kStartupSnapshotAlignment);
   }
 
   static uint32_t ContextSnapshotOffsetOffset(int index) {
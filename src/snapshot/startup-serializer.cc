@@ -28,7 +28,10 @@ StartupSerializer::~StartupSerializer() {
 
 void StartupSerializer::SerializeObject(HeapObject* obj, HowToCode how_to_code,
                                         WhereToPoint where_to_point, int skip) {
-  DCHECK(!ObjectIsBytecodeHandler(obj));  // Only referenced in dispatch table.
+  // Bytecode handlers are only referenced in the dispatch table, except for
+  // the DeserializeLazy handlers, which are directly referenced as heap roots.
+  DCHECK_IMPLIES(ObjectIsBytecodeHandler(obj),
+                 isolate()->heap()->IsDeserializeLazyHandler(Code::cast(obj)));
   DCHECK(!obj->IsJSFunction());
 
   if (clear_function_code() && obj->IsBytecodeArray()) {
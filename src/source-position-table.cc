@@ -23,6 +23,19 @@ namespace internal {
 // - we just stuff one bit for the type into the code offset,
 // - we write least-significant bits first,
 // - we use zig-zag encoding to encode both positive and negative numbers.
+//
+// Since entries are delta-encoded, looking up the position for a given code
+// offset normally requires decoding the stream from the start. To keep such
+// lookups sub-linear, the stream is preceded by a small fixed-width index:
+// every kIndexGranularity-th entry is recorded with absolute values together
+// with the byte offset at which decoding can resume. Lookups binary search
+// the index and then decode at most kIndexGranularity entries. The table
+// layout is:
+// - int32: number of index records
+// - per record: int32 byte offset into the stream (relative to its start),
+//   int32 code offset with the type folded into the sign as in the stream,
+//   int64 source position; all absolute values of the recorded entry
+// - the variable-length entry stream
 
 namespace {
 
@@ -30,6 +43,24 @@ namespace {
 class MoreBit : public BitField8<bool, 7, 1> {};
 class ValueBits : public BitField8<unsigned, 0, 7> {};
 
+const int kIndexGranularity = 32;
+const int kIndexHeaderSize = kIntSize;
+const int kIndexRecordSize = 2 * kIntSize + kInt64Size;
+
+// Helpers: The index uses fixed-width fields which are not necessarily
+// aligned within the ByteArray, so read and write them bytewise.
+template <typename T>
+T ReadField(ByteArray* table, int offset) {
+  T value;
+  MemCopy(&value, table->GetDataStartAddress() + offset, sizeof(value));
+  return value;
+}
+
+template <typename T>
+void WriteField(ByteArray* table, int offset, T value) {
+  MemCopy(table->GetDataStartAddress() + offset, &value, sizeof(value));
+}
+
 // Helper: Add the offsets from 'other' to 'value'. Also set is_statement.
 void AddAndSetEntry(PositionTableEntry& value,
                     const PositionTableEntry& other) {
@@ -111,6 +142,8 @@ SourcePositionTableBuilder::SourcePositionTableBuilder(
     Zone* zone, SourcePositionTableBuilder::RecordingMode mode)
     : mode_(mode),
       bytes_(zone),
+      index_(zone),
+      num_entries_(0),
 #ifdef ENABLE_SLOW_DCHECKS
       raw_entries_(zone),
 #endif
@@ -131,6 +164,11 @@ void SourcePositionTableBuilder::AddEntry(const PositionTableEntry& entry) {
   SubtractFromEntry(tmp, previous_);
   EncodeEntry(bytes_, tmp);
   previous_ = entry;
+  if (++num_entries_ % kIndexGranularity == 0) {
+    // Record the absolute values of this entry together with the stream
+    // offset at which decoding can resume after it.
+    index_.push_back({static_cast<int>(bytes_.size()), entry});
+  }
 #ifdef ENABLE_SLOW_DCHECKS
   raw_entries_.push_back(entry);
 #endif
@@ -141,10 +179,25 @@ Handle<ByteArray> SourcePositionTableBuilder::ToSourcePositionTable(
   if (bytes_.empty()) return isolate->factory()->empty_byte_array();
   DCHECK(!Omit());
 
+  int index_size =
+      kIndexHeaderSize + static_cast<int>(index_.size()) * kIndexRecordSize;
   Handle<ByteArray> table = isolate->factory()->NewByteArray(
-      static_cast<int>(bytes_.size()), TENURED);
+      index_size + static_cast<int>(bytes_.size()), TENURED);
 
-  MemCopy(table->GetDataStartAddress(), &*bytes_.begin(), bytes_.size());
+  WriteField<int32_t>(*table, 0, static_cast<int32_t>(index_.size()));
+  int offset = kIndexHeaderSize;
+  for (const IndexEntry& index_entry : index_) {
+    const PositionTableEntry& entry = index_entry.entry;
+    WriteField<int32_t>(*table, offset, index_entry.byte_offset);
+    WriteField<int32_t>(*table, offset + kIntSize,
+                        entry.is_statement ? entry.code_offset
+                                           : -entry.code_offset - 1);
+    WriteField<int64_t>(*table, offset + 2 * kIntSize, entry.source_position);
+    offset += kIndexRecordSize;
+  }
+  DCHECK_EQ(offset, index_size);
+  MemCopy(table->GetDataStartAddress() + index_size, &*bytes_.begin(),
+          bytes_.size());
 
 #ifdef ENABLE_SLOW_DCHECKS
   // Brute force testing: Record all positions and decode
@@ -166,17 +219,67 @@ Handle<ByteArray> SourcePositionTableBuilder::ToSourcePositionTable(
 
 SourcePositionTableIterator::SourcePositionTableIterator(ByteArray* byte_array)
     : raw_table_(byte_array) {
-  Advance();
+  Initialize();
 }
 
 SourcePositionTableIterator::SourcePositionTableIterator(
     Handle<ByteArray> byte_array)
     : table_(byte_array) {
-  Advance();
+  Initialize();
   // We can enable allocation because we keep the table in a handle.
   no_gc.Release();
 }
 
+void SourcePositionTableIterator::Initialize() {
+  ByteArray* table = raw_table_ ? raw_table_ : *table_;
+  if (table->length() == 0) {
+    index_ = kDone;
+    return;
+  }
+  // Skip over the index; linear iteration only uses the entry stream.
+  index_ = kIndexHeaderSize +
+           ReadField<int32_t>(table, 0) * kIndexRecordSize;
+  Advance();
+}
+
+void SourcePositionTableIterator::SeekForward(int code_offset) {
+  DCHECK(!done());
+  ByteArray* table = raw_table_ ? raw_table_ : *table_;
+  int index_length = ReadField<int32_t>(table, 0);
+  // Binary search for the last index record at or before {code_offset}.
+  int left = -1;
+  int right = index_length;
+  while (right - left > 1) {
+    int mid = left + (right - left) / 2;
+    int folded =
+        ReadField<int32_t>(table, kIndexHeaderSize + mid * kIndexRecordSize +
+                                      kIntSize);
+    int mid_code_offset = folded >= 0 ? folded : -folded - 1;
+    if (mid_code_offset <= code_offset) {
+      left = mid;
+    } else {
+      right = mid;
+    }
+  }
+  if (left < 0) return;
+  int record_offset = kIndexHeaderSize + left * kIndexRecordSize;
+  int stream_offset = kIndexHeaderSize + index_length * kIndexRecordSize +
+                      ReadField<int32_t>(table, record_offset);
+  // Only ever skip forward; the iterator may already be past this record.
+  if (stream_offset <= index_) return;
+  int folded = ReadField<int32_t>(table, record_offset + kIntSize);
+  if (folded >= 0) {
+    current_.is_statement = true;
+    current_.code_offset = folded;
+  } else {
+    current_.is_statement = false;
+    current_.code_offset = -folded - 1;
+  }
+  current_.source_position =
+      ReadField<int64_t>(table, record_offset + 2 * kIntSize);
+  index_ = stream_offset;
+}
+
 void SourcePositionTableIterator::Advance() {
   ByteArray* table = raw_table_ ? raw_table_ : *table_;
   DCHECK(!done());
@@ -44,12 +44,21 @@ class V8_EXPORT_PRIVATE SourcePositionTableBuilder {
   Handle<ByteArray> ToSourcePositionTable(Isolate* isolate);
 
  private:
+  // An index record, pairing the absolute values of an entry with the offset
+  // in the encoded stream at which decoding can resume after it.
+  struct IndexEntry {
+    int byte_offset;
+    PositionTableEntry entry;
+  };
+
   void AddEntry(const PositionTableEntry& entry);
 
   inline bool Omit() const { return mode_ == OMIT_SOURCE_POSITIONS; }
 
   RecordingMode mode_;
   ZoneVector<byte> bytes_;
+  ZoneVector<IndexEntry> index_;
+  int num_entries_;
 #ifdef ENABLE_SLOW_DCHECKS
   ZoneVector<PositionTableEntry> raw_entries_;
 #endif
@@ -78,6 +87,14 @@ class V8_EXPORT_PRIVATE SourcePositionTableIterator {
 
   void Advance();
 
+  // Skips forward to the last indexed entry at or before {code_offset}, if
+  // that is further along than the current position. The builder records
+  // every kIndexGranularity-th entry in a fixed-width index ahead of the
+  // stream, so a lookup by code offset is a binary search over the index
+  // followed by at most kIndexGranularity decoded entries instead of a
+  // decode of the whole table.
+  void SeekForward(int code_offset);
+
   int code_offset() const {
     DCHECK(!done());
     return current_.code_offset;
@@ -102,6 +119,8 @@ class V8_EXPORT_PRIVATE SourcePositionTableIterator {
  private:
   static const int kDone = -1;
 
+  void Initialize();
+
   ByteArray* raw_table_ = nullptr;
   Handle<ByteArray> table_;
   int index_ = 0;
@@ -353,6 +353,11 @@ class IncrementalStringBuilder {
       const uint8_t* u = reinterpret_cast<const uint8_t*>(s);
       while (*u != '\0') Append(*(u++));
     }
+    template <typename SrcChar>
+    INLINE(void AppendChars(Vector<const SrcChar> chars)) {
+      CopyChars(cursor_, chars.start(), chars.length());
+      cursor_ += chars.length();
+    }
 
     int written() { return static_cast<int>(cursor_ - start_); }
 
@@ -4,6 +4,7 @@
 
 #include "src/uri.h"
 
+#include <cstring>
 #include <vector>
 
 #include "src/char-predicates-inl.h"
@@ -176,6 +177,18 @@ bool IntoOneAndTwoByte(Handle<String> uri, bool is_uri,
 MaybeHandle<String> Uri::Decode(Isolate* isolate, Handle<String> uri,
                                 bool is_uri) {
   uri = String::Flatten(uri);
+
+  {
+    // One-byte strings without any '%' decode to themselves, which is the
+    // common case for already-decoded inputs.
+    DisallowHeapAllocation no_gc;
+    String::FlatContent uri_content = uri->GetFlatContent();
+    if (uri_content.IsOneByte()) {
+      Vector<const uint8_t> chars = uri_content.ToOneByteVector();
+      if (memchr(chars.start(), '%', chars.length()) == nullptr) return uri;
+    }
+  }
+
   std::vector<uint8_t> one_byte_buffer;
   std::vector<uc16> two_byte_buffer;
 
@@ -243,6 +256,10 @@ bool IsUriSeparator(uc16 c) {
   }
 }
 
+bool IsUnescapedCharacter(uc16 c, bool is_uri) {
+  return IsUnescapePredicateInUriComponent(c) || (is_uri && IsUriSeparator(c));
+}
+
 void AddEncodedOctetToBuffer(uint8_t octet, std::vector<uint8_t>* buffer) {
   buffer->push_back('%');
   buffer->push_back(HexCharOfValue(octet >> 4));
@@ -282,29 +299,45 @@ MaybeHandle<String> Uri::Encode(Isolate* isolate, Handle<String> uri,
     DisallowHeapAllocation no_gc;
     String::FlatContent uri_content = uri->GetFlatContent();
 
-    for (int k = 0; k < uri_length; k++) {
-      uc16 cc1 = uri_content.Get(k);
-      if (unibrow::Utf16::IsLeadSurrogate(cc1)) {
-        k++;
-        if (k < uri_length) {
-          uc16 cc2 = uri->Get(k);
-          if (unibrow::Utf16::IsTrailSurrogate(cc2)) {
-            EncodePair(cc1, cc2, &buffer);
-            continue;
+    if (uri_content.IsOneByte()) {
+      // One-byte content contains no surrogates, so every character either
+      // passes through unescaped or is percent-encoded on its own. Copy
+      // maximal unescaped runs in one go, and return the input unchanged if
+      // the whole string is one such run.
+      Vector<const uint8_t> chars = uri_content.ToOneByteVector();
+      int k = 0;
+      while (k < uri_length) {
+        int run_start = k;
+        while (k < uri_length && IsUnescapedCharacter(chars[k], is_uri)) k++;
+        if (run_start == 0 && k == uri_length) return uri;
+        buffer.insert(buffer.end(), chars.start() + run_start,
+                      chars.start() + k);
+        if (k < uri_length) EncodeSingle(chars[k++], &buffer);
+      }
+    } else {
+      for (int k = 0; k < uri_length; k++) {
+        uc16 cc1 = uri_content.Get(k);
+        if (unibrow::Utf16::IsLeadSurrogate(cc1)) {
+          k++;
+          if (k < uri_length) {
+            uc16 cc2 = uri->Get(k);
+            if (unibrow::Utf16::IsTrailSurrogate(cc2)) {
+              EncodePair(cc1, cc2, &buffer);
+              continue;
+            }
           }
+        } else if (!unibrow::Utf16::IsTrailSurrogate(cc1)) {
+          if (IsUnescapedCharacter(cc1, is_uri)) {
+            buffer.push_back(cc1);
+          } else {
+            EncodeSingle(cc1, &buffer);
+          }
+          continue;
         }
-      } else if (!unibrow::Utf16::IsTrailSurrogate(cc1)) {
-        if (IsUnescapePredicateInUriComponent(cc1) ||
-            (is_uri && IsUriSeparator(cc1))) {
-          buffer.push_back(cc1);
-        } else {
-          EncodeSingle(cc1, &buffer);
-        }
-        continue;
-      }
 
-      AllowHeapAllocation allocate_error_and_return;
-      THROW_NEW_ERROR(isolate, NewURIError(), String);
+        AllowHeapAllocation allocate_error_and_return;
+        THROW_NEW_ERROR(isolate, NewURIError(), String);
+      }
     }
   }
 
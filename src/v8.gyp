@@ -1370,6 +1370,8 @@
         'snapshot/serializer-common.h',
         'snapshot/serializer.h',
         'snapshot/snapshot-common.cc',
+        'snapshot/snapshot-compression.cc',
+        'snapshot/snapshot-compression.h',
         'snapshot/snapshot.h',
         'snapshot/snapshot-source-sink.cc',
         'snapshot/snapshot-source-sink.h',
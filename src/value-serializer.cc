@@ -594,9 +594,21 @@ Maybe<bool> ValueSerializer::WriteJSArray(Handle<JSArray> array) {
         if (length == 0) break;
         Handle<FixedDoubleArray> elements(
             FixedDoubleArray::cast(array->elements()), isolate_);
+        // Each element is encoded as a tag byte followed by the raw double,
+        // so the total size is known up front. Reserving it in one go avoids
+        // a capacity check for every element, which dominates when cloning
+        // large numeric arrays.
+        static const size_t kBytesPerElement = 1 + sizeof(double);
+        uint8_t* dest;
+        if (!ReserveRawBytes(length * kBytesPerElement).To(&dest)) {
+          return ThrowIfOutOfMemory();
+        }
         for (; i < length; i++) {
-          WriteTag(SerializationTag::kDouble);
-          WriteDouble(elements->get_scalar(i));
+          *dest++ = static_cast<uint8_t>(SerializationTag::kDouble);
+          // Warning: this uses host endianness, like WriteDouble.
+          double value = elements->get_scalar(i);
+          memcpy(dest, &value, sizeof(value));
+          dest += sizeof(value);
         }
         break;
       }
@@ -1387,28 +1399,69 @@ MaybeHandle<JSArray> ValueDeserializer::ReadDenseJSArray() {
 
   uint32_t id = next_id_++;
   HandleScope scope(isolate_);
-  Handle<JSArray> array = isolate_->factory()->NewJSArray(
-      HOLEY_ELEMENTS, length, length, INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE,
-      pretenure_);
-  AddObjectWithID(id, array);
 
-  Handle<FixedArray> elements(FixedArray::cast(array->elements()), isolate_);
-  for (uint32_t i = 0; i < length; i++) {
-    SerializationTag tag;
-    if (PeekTag().To(&tag) && tag == SerializationTag::kTheHole) {
-      ConsumeTag(SerializationTag::kTheHole);
-      continue;
+  // Arrays of doubles are common in structured-clone traffic, and each such
+  // element occupies exactly one tag byte plus the raw value. A cheap scan
+  // over the tag bytes therefore tells us up front whether the entire
+  // element section consists of doubles, in which case we can build a
+  // double-elements array directly instead of allocating a HeapNumber per
+  // element. Anything unexpected (including padding) takes the generic path.
+  static const size_t kBytesPerDoubleElement = 1 + sizeof(double);
+  bool all_doubles =
+      length > 0 &&
+      static_cast<size_t>(end_ - position_) >=
+          length * kBytesPerDoubleElement;
+  if (all_doubles) {
+    const uint8_t* tag_position = position_;
+    for (uint32_t i = 0; i < length; i++) {
+      if (*tag_position != static_cast<uint8_t>(SerializationTag::kDouble)) {
+        all_doubles = false;
+        break;
+      }
+      tag_position += kBytesPerDoubleElement;
+    }
+  }
+
+  Handle<JSArray> array;
+  if (all_doubles) {
+    array = isolate_->factory()->NewJSArray(
+        HOLEY_DOUBLE_ELEMENTS, length, length,
+        INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE, pretenure_);
+    AddObjectWithID(id, array);
+
+    Handle<FixedDoubleArray> elements(
+        FixedDoubleArray::cast(array->elements()), isolate_);
+    for (uint32_t i = 0; i < length; i++) {
+      ConsumeTag(SerializationTag::kDouble);
+      double value;
+      if (!ReadDouble().To(&value)) return MaybeHandle<JSArray>();
+      elements->set(i, value);
     }
+  } else {
+    array = isolate_->factory()->NewJSArray(
+        HOLEY_ELEMENTS, length, length, INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE,
+        pretenure_);
+    AddObjectWithID(id, array);
+
+    Handle<FixedArray> elements(FixedArray::cast(array->elements()),
+                                isolate_);
+    for (uint32_t i = 0; i < length; i++) {
+      SerializationTag tag;
+      if (PeekTag().To(&tag) && tag == SerializationTag::kTheHole) {
+        ConsumeTag(SerializationTag::kTheHole);
+        continue;
+      }
 
-    Handle<Object> element;
-    if (!ReadObject().ToHandle(&element)) return MaybeHandle<JSArray>();
+      Handle<Object> element;
+      if (!ReadObject().ToHandle(&element)) return MaybeHandle<JSArray>();
 
-    // Serialization versions less than 11 encode the hole the same as
-    // undefined. For consistency with previous behavior, store these as the
-    // hole. Past version 11, undefined means undefined.
-    if (version_ < 11 && element->IsUndefined(isolate_)) continue;
+      // Serialization versions less than 11 encode the hole the same as
+      // undefined. For consistency with previous behavior, store these as
+      // the hole. Past version 11, undefined means undefined.
+      if (version_ < 11 && element->IsUndefined(isolate_)) continue;
 
-    elements->set(i, *element);
+      elements->set(i, *element);
+    }
   }
 
   uint32_t num_properties;
@@ -9,6 +9,7 @@
 #include "src/api.h"
 #include "src/asmjs/asm-js.h"
 #include "src/assembler-inl.h"
+#include "src/base/platform/semaphore.h"
 #include "src/base/template-utils.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/code-stubs.h"
@@ -107,6 +108,8 @@ class ModuleCompiler {
 
     void Clear() { units_.clear(); }
 
+    size_t size() const { return units_.size(); }
+
    private:
     ModuleCompiler* compiler_;
     std::vector<std::unique_ptr<compiler::WasmCompilationUnit>> units_;
@@ -461,11 +464,95 @@ static void InstanceFinalizer(const v8::WeakCallbackInfo<void>& data) {
   TRACE("}\n");
 }
 
+namespace {
+
+// Shared state for the parallel function body validation below. Workers
+// claim function indices from {next_function_} and raise {failed_} on the
+// first invalid body; WebAssembly.validate only needs a verdict, so no
+// error message or position is collected.
+class ParallelBodyValidation {
+ public:
+  ParallelBodyValidation(const WasmModule* module,
+                         const ModuleWireBytes& wire_bytes,
+                         AccountingAllocator* allocator)
+      : module_(module), wire_bytes_(wire_bytes), allocator_(allocator) {}
+
+  void ValidateBodies() {
+    const std::vector<WasmFunction>& functions = module_->functions;
+    const byte* base = wire_bytes_.start();
+    while (!failed_.load(std::memory_order_relaxed)) {
+      size_t i = next_function_.Increment(1) - 1;
+      if (i >= functions.size()) break;
+      const WasmFunction& func = functions[i];
+      if (func.imported) continue;
+      FunctionBody body{func.sig, func.code.offset(),
+                        base + func.code.offset(),
+                        base + func.code.end_offset()};
+      if (VerifyWasmCode(allocator_, module_, body).failed()) {
+        failed_.store(true, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool failed() const { return failed_.load(std::memory_order_relaxed); }
+  base::Semaphore* done_semaphore() { return &done_semaphore_; }
+
+ private:
+  const WasmModule* const module_;
+  const ModuleWireBytes wire_bytes_;
+  AccountingAllocator* const allocator_;
+  base::AtomicNumber<size_t> next_function_;
+  std::atomic<bool> failed_{false};
+  base::Semaphore done_semaphore_{0};
+};
+
+class ValidationTask : public CancelableTask {
+ public:
+  ValidationTask(Isolate* isolate, ParallelBodyValidation* validation)
+      : CancelableTask(isolate->cancelable_task_manager()),
+        validation_(validation) {}
+
+  void RunInternal() override {
+    validation_->ValidateBodies();
+    validation_->done_semaphore()->Signal();
+  }
+
+ private:
+  ParallelBodyValidation* const validation_;
+};
+
+// Validates the bodies of the declared functions of {module} in parallel.
+// The caller must have decoded {module} from {wire_bytes} already.
+bool ValidateBodiesInParallel(Isolate* isolate, const WasmModule* module,
+                              const ModuleWireBytes& wire_bytes) {
+  ParallelBodyValidation validation(module, wire_bytes, isolate->allocator());
+  size_t num_background_tasks =
+      Min(static_cast<size_t>(FLAG_wasm_num_compilation_tasks),
+          V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads());
+  for (size_t i = 0; i < num_background_tasks; ++i) {
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        new ValidationTask(isolate, &validation),
+        v8::Platform::ExpectedRuntime::kShortRunningTask);
+  }
+  // This thread contributes as well instead of only waiting.
+  validation.ValidateBodies();
+  for (size_t i = 0; i < num_background_tasks; ++i) {
+    validation.done_semaphore()->Wait();
+  }
+  return !validation.failed();
+}
+
+}  // namespace
+
 bool SyncValidate(Isolate* isolate, const ModuleWireBytes& bytes) {
   if (bytes.start() == nullptr || bytes.length() == 0) return false;
+  // Decode the module structure without verifying function bodies, then
+  // validate the bodies in parallel; they dominate validation time for
+  // large modules.
   ModuleResult result = SyncDecodeWasmModule(isolate, bytes.start(),
-                                             bytes.end(), true, kWasmOrigin);
-  return result.ok();
+                                             bytes.end(), false, kWasmOrigin);
+  if (result.failed()) return false;
+  return ValidateBodiesInParallel(isolate, result.val.get(), bytes);
 }
 
 MaybeHandle<WasmModuleObject> SyncCompileTranslatedAsmJs(
@@ -2869,6 +2956,10 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
   void OnAbort() override;
 
  private:
+  // Number of compilation units buffered before they are handed to the
+  // background tasks mid-chunk; see ProcessFunctionBody.
+  static const size_t kUnitsPerStreamingCommit = 10;
+
   // Finishes the AsyncCOmpileJob with an error.
   void FinishAsyncCompileJobWithError(ResultBase result);
 
@@ -3456,6 +3547,14 @@ bool AsyncStreamingProcessor::ProcessFunctionBody(Vector<const uint8_t> bytes,
     WasmName name = {nullptr, 0};
     compilation_unit_builder_->AddUnit(job_->module_env_.get(), func, offset,
                                        bytes, name);
+    // A large network chunk can contain hundreds of small function bodies;
+    // hand the accumulated units to the background tasks periodically so
+    // that compilation overlaps with decoding the rest of the chunk instead
+    // of only starting at chunk boundaries.
+    if (compilation_unit_builder_->size() >= kUnitsPerStreamingCommit) {
+      compilation_unit_builder_->Commit();
+      job_->RestartBackgroundTasks();
+    }
   }
   ++next_function_;
   return true;
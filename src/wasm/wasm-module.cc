@@ -99,8 +99,13 @@ void UnpackAndRegisterProtectedInstructions(Isolate* isolate,
 
     unpacked.clear();
 
-    // TODO (eholk): if index is negative, fail. id:1754 gh:1762
-    DCHECK_LE(0, index);
+    // The code was compiled without explicit bounds checks, so executing it
+    // with the metadata unregistered would turn every out-of-bounds access
+    // into memory corruption. Registration only fails on allocation failure
+    // of the (small) metadata table, so treat it like any other OOM.
+    if (index < 0) {
+      V8::FatalProcessOutOfMemory("UnpackAndRegisterProtectedInstructions");
+    }
     code->set_trap_handler_index(Smi::FromInt(index));
   }
 }
@@ -6,6 +6,8 @@
 
 #include <cstdlib>
 
+#include "src/base/platform/platform.h"
+
 #if V8_LIBC_BIONIC
 #include <malloc.h>  // NOLINT
 #endif
@@ -17,6 +19,9 @@ AccountingAllocator::AccountingAllocator() : unused_segments_mutex_() {
   static const size_t kDefaultBucketMaxSize = 5;
 
   memory_pressure_level_.SetValue(MemoryPressureLevel::kNone);
+  for (size_t line = 0; line < kThreadCacheLines; line++) {
+    std::fill(thread_cache_[line], thread_cache_[line] + kNumberBuckets, 0);
+  }
   std::fill(unused_segments_heads_, unused_segments_heads_ + kNumberBuckets,
             nullptr);
   std::fill(unused_segments_sizes_, unused_segments_sizes_ + kNumberBuckets, 0);
@@ -138,8 +143,11 @@ Segment* AccountingAllocator::GetSegmentFromPool(size_t requested_size) {
   DCHECK_GE(power, kMinSegmentSizePower + 0);
   power -= kMinSegmentSizePower;
 
-  Segment* segment;
-  {
+  // Try the lock-free per-thread cache first; only take the shared pool
+  // mutex on a miss.
+  Segment* segment = GetSegmentFromThreadCache(power);
+
+  if (segment == nullptr) {
     base::LockGuard<base::Mutex> lock_guard(&unused_segments_mutex_);
 
     segment = unused_segments_heads_[power];
@@ -174,6 +182,8 @@ bool AccountingAllocator::AddSegmentToPool(Segment* segment) {
   DCHECK_GE(power, kMinSegmentSizePower + 0);
   power -= kMinSegmentSizePower;
 
+  if (AddSegmentToThreadCache(segment, power)) return true;
+
   {
     base::LockGuard<base::Mutex> lock_guard(&unused_segments_mutex_);
 
@@ -190,7 +200,61 @@ bool AccountingAllocator::AddSegmentToPool(Segment* segment) {
   return true;
 }
 
+// static
+size_t AccountingAllocator::ThreadCacheLine() {
+  return static_cast<size_t>(base::OS::GetCurrentThreadId()) %
+         kThreadCacheLines;
+}
+
+Segment* AccountingAllocator::GetSegmentFromThreadCache(size_t power) {
+  DCHECK_LT(power, kNumberBuckets);
+  size_t line = ThreadCacheLine();
+  for (size_t i = 0; i < kThreadCacheLines; i++) {
+    base::AtomicWord* slot =
+        &thread_cache_[(line + i) % kThreadCacheLines][power];
+    base::AtomicWord entry = base::Acquire_Load(slot);
+    if (entry == 0) continue;
+    // Claim the slot; if another thread raced us to it, steal from the next
+    // line instead of retrying.
+    if (base::Acquire_CompareAndSwap(slot, entry, 0) != entry) continue;
+    Segment* segment = reinterpret_cast<Segment*>(entry);
+    base::Relaxed_AtomicIncrement(
+        &current_pool_size_, -static_cast<base::AtomicWord>(segment->size()));
+    return segment;
+  }
+  return nullptr;
+}
+
+bool AccountingAllocator::AddSegmentToThreadCache(Segment* segment,
+                                                 size_t power) {
+  DCHECK_LT(power, kNumberBuckets);
+  base::AtomicWord* slot = &thread_cache_[ThreadCacheLine()][power];
+  if (base::Acquire_Load(slot) != 0) return false;
+  if (base::Release_CompareAndSwap(
+          slot, 0, reinterpret_cast<base::AtomicWord>(segment)) != 0) {
+    return false;
+  }
+  base::Relaxed_AtomicIncrement(&current_pool_size_, segment->size());
+  return true;
+}
+
+void AccountingAllocator::ClearThreadCache() {
+  for (size_t line = 0; line < kThreadCacheLines; line++) {
+    for (size_t power = 0; power < kNumberBuckets; power++) {
+      base::AtomicWord entry =
+          base::Relaxed_AtomicExchange(&thread_cache_[line][power], 0);
+      if (entry == 0) continue;
+      Segment* segment = reinterpret_cast<Segment*>(entry);
+      base::Relaxed_AtomicIncrement(
+          &current_pool_size_, -static_cast<base::AtomicWord>(segment->size()));
+      FreeSegment(segment);
+    }
+  }
+}
+
 void AccountingAllocator::ClearPool() {
+  ClearThreadCache();
+
   base::LockGuard<base::Mutex> lock_guard(&unused_segments_mutex_);
 
   for (size_t power = 0; power <= kMaxSegmentSizePower - kMinSegmentSizePower;
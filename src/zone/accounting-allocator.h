@@ -20,7 +20,12 @@ namespace internal {
 
 class V8_EXPORT_PRIVATE AccountingAllocator {
  public:
-  static const size_t kMaxPoolSize = 8ul * KB;
+  // Default budget for the segment pool. One full set of segment size
+  // classes (8KB..256KB) sums to ~504KB, so this retains about two segments
+  // of every size class across zone lifetimes, which is enough to serve
+  // repeated compile bursts from the pool instead of malloc. The pool is
+  // dropped entirely on memory pressure notifications.
+  static const size_t kMaxPoolSize = 1ul * MB;
 
   AccountingAllocator();
   virtual ~AccountingAllocator();
@@ -66,9 +71,27 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   // Trys to add a segment to the pool. Returns false if the pool is full.
   bool AddSegmentToPool(Segment* segment);
 
+  // The pool is fronted by a lock-free per-thread cache. Each thread maps to
+  // one cache line, and each line holds at most one segment per size class,
+  // accessed with atomic operations only; a thread whose own line is empty
+  // steals from the other lines. This keeps zones that grow and shrink
+  // repeatedly (e.g. background parse tasks) from contending on the shared
+  // pool mutex. The cache holds at most one segment of each size class per
+  // line in addition to the configured pool size.
+  static size_t ThreadCacheLine();
+  // |power| is the size class index, as computed by GetSegmentFromPool and
+  // AddSegmentToPool.
+  Segment* GetSegmentFromThreadCache(size_t power);
+  bool AddSegmentToThreadCache(Segment* segment, size_t power);
+  void ClearThreadCache();
+
   // Empties the pool and puts all its contents onto the garbage stack.
   void ClearPool();
 
+  static const size_t kThreadCacheLines = 8;
+
+  base::AtomicWord thread_cache_[kThreadCacheLines][kNumberBuckets];
+
   Segment* unused_segments_heads_[kNumberBuckets];
 
   size_t unused_segments_sizes_[kNumberBuckets];
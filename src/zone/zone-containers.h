@@ -5,6 +5,7 @@
 #ifndef V8_SRC_ZONE_ZONE_CONTAINERS_H_
 #define V8_SRC_ZONE_ZONE_CONTAINERS_H_
 
+#include <cstring>
 #include <deque>
 #include <forward_list>
 #include <list>
@@ -17,6 +18,8 @@
 #include <vector>
 
 #include "src/base/functional.h"
+#include "src/base/logging.h"
+#include "src/base/macros.h"
 #include "src/zone/zone-allocator.h"
 
 namespace v8 {
@@ -48,6 +51,85 @@ class ZoneVector : public std::vector<T, ZoneAllocator<T>> {
       : std::vector<T, ZoneAllocator<T>>(first, last, ZoneAllocator<T>(zone)) {}
 };
 
+// A vector with inline storage for its first {kSize} elements, for the
+// compiler's many short-lived worklists that are almost always tiny. As long
+// as the vector stays within its inline capacity it performs no zone
+// allocation at all; when it grows it spills into the zone. The element type
+// must be trivially copyable so growth is a plain memcpy. Like other zone
+// containers, spilled storage is not reclaimed before the zone dies.
+template <typename T, size_t kSize>
+class SmallZoneVector final {
+ public:
+  static_assert(IS_TRIVIALLY_COPYABLE(T),
+                "SmallZoneVector only supports trivially copyable types");
+
+  explicit SmallZoneVector(Zone* zone)
+      : zone_(zone),
+        begin_(reinterpret_cast<T*>(inline_storage_)),
+        end_(begin_),
+        end_of_storage_(begin_ + kSize) {}
+
+  bool empty() const { return end_ == begin_; }
+  size_t size() const { return static_cast<size_t>(end_ - begin_); }
+  size_t capacity() const {
+    return static_cast<size_t>(end_of_storage_ - begin_);
+  }
+
+  T* begin() { return begin_; }
+  const T* begin() const { return begin_; }
+  T* end() { return end_; }
+  const T* end() const { return end_; }
+
+  T& operator[](size_t index) {
+    DCHECK_LT(index, size());
+    return begin_[index];
+  }
+  const T& operator[](size_t index) const {
+    DCHECK_LT(index, size());
+    return begin_[index];
+  }
+
+  T& back() {
+    DCHECK(!empty());
+    return end_[-1];
+  }
+  const T& back() const {
+    DCHECK(!empty());
+    return end_[-1];
+  }
+
+  void push_back(const T& value) {
+    if (V8_UNLIKELY(end_ == end_of_storage_)) Grow();
+    *end_++ = value;
+  }
+
+  void pop_back() {
+    DCHECK(!empty());
+    --end_;
+  }
+
+  void clear() { end_ = begin_; }
+
+ private:
+  void Grow() {
+    size_t length = size();
+    size_t new_capacity = 2 * capacity();
+    T* new_begin = zone_->NewArray<T>(new_capacity);
+    std::memcpy(new_begin, begin_, length * sizeof(T));
+    begin_ = new_begin;
+    end_ = new_begin + length;
+    end_of_storage_ = new_begin + new_capacity;
+  }
+
+  Zone* zone_;
+  T* begin_;
+  T* end_;
+  T* end_of_storage_;
+  alignas(T) char inline_storage_[kSize * sizeof(T)];
+
+  DISALLOW_COPY_AND_ASSIGN(SmallZoneVector);
+};
+
 // A wrapper subclass for std::deque to make it easy to construct one
 // that uses a zone allocator.
 template <typename T>
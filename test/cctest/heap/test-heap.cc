@@ -1361,6 +1361,64 @@ TEST(CompilationCacheCachingBehavior) {
   CHECK(!pair.has_shared());
 }
 
+TEST(BytecodeFlushing) {
+  FLAG_flush_bytecode = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+
+  // Compile a function and drop the only closure referring to it, so that
+  // only the (global-handle protected) shared function info survives.
+  Handle<SharedFunctionInfo> shared;
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    CompileRun(
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()");
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+    Handle<Object> func_value =
+        Object::GetProperty(isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared()->is_compiled());
+    shared = Handle<SharedFunctionInfo>::cast(
+        isolate->global_handles()->Create(function->shared()));
+    CompileRun("foo = null;");
+  }
+
+  // The bytecode has not aged yet, so a full GC must not flush it.
+  CcTest::CollectAllGarbage();
+  CHECK(shared->is_compiled());
+  CHECK(shared->HasBytecodeArray());
+
+  // Progress the bytecode age until it is considered old.
+  const int kAgingThreshold = 6;
+  for (int i = 0; i < kAgingThreshold; i++) {
+    shared->bytecode_array()->MakeOlder();
+  }
+
+  // A full GC should now flush the bytecode and reset the function to lazily
+  // compile again on its next call.
+  CcTest::CollectAllGarbage();
+  CHECK(!shared->is_compiled());
+  CHECK(!shared->HasBytecodeArray());
+
+  // Calling a fresh closure over the flushed shared function info recompiles
+  // it from source.
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    Handle<JSFunction> function = factory->NewFunctionFromSharedFunctionInfo(
+        shared, isolate->native_context());
+    Execution::Call(isolate, function, factory->undefined_value(), 0, nullptr)
+        .ToHandleChecked();
+  }
+  CHECK(shared->is_compiled());
+  CHECK(shared->HasBytecodeArray());
+}
 
 static void OptimizeEmptyFunction(const char* name) {
   HandleScope scope(CcTest::i_isolate());
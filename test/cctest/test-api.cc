@@ -15881,6 +15881,57 @@ TEST(CreateDataProperty) {
 }
 
 
+TEST(CreateDataProperties) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+
+  CompileRun(
+      "var a = {};"
+      "Object.defineProperty(a, 'foo', {value: 23});");
+
+  v8::Local<v8::Object> obj = v8::Local<v8::Object>::Cast(
+      env->Global()->Get(env.local(), v8_str("a")).ToLocalChecked());
+  {
+    // Define a batch of fresh properties.
+    v8::TryCatch try_catch(isolate);
+    v8::Local<v8::Name> keys[] = {v8_str("x"), v8_str("y"), v8_str("z")};
+    v8::Local<v8::Value> values[] = {v8::Integer::New(isolate, 1),
+                                     v8::Integer::New(isolate, 2),
+                                     v8::Integer::New(isolate, 3)};
+    CHECK(obj->CreateDataProperties(env.local(), keys, values, arraysize(keys))
+              .FromJust());
+    CHECK(!try_catch.HasCaught());
+    for (int i = 0; i < 3; i++) {
+      v8::Local<v8::Value> val =
+          obj->Get(env.local(), keys[i]).ToLocalChecked();
+      CHECK_EQ(i + 1, val->Int32Value(env.local()).FromJust());
+    }
+  }
+
+  {
+    // A non-configurable property stops the batch; earlier pairs stick.
+    v8::TryCatch try_catch(isolate);
+    v8::Local<v8::Name> keys[] = {v8_str("v"), v8_str("foo"), v8_str("w")};
+    v8::Local<v8::Value> values[] = {v8::Integer::New(isolate, 4),
+                                     v8::Integer::New(isolate, 5),
+                                     v8::Integer::New(isolate, 6)};
+    CHECK(!obj->CreateDataProperties(env.local(), keys, values, arraysize(keys))
+               .FromJust());
+    CHECK(!try_catch.HasCaught());
+    CHECK_EQ(4, obj->Get(env.local(), v8_str("v"))
+                    .ToLocalChecked()
+                    ->Int32Value(env.local())
+                    .FromJust());
+    CHECK_EQ(23, obj->Get(env.local(), v8_str("foo"))
+                     .ToLocalChecked()
+                     ->Int32Value(env.local())
+                     .FromJust());
+    CHECK(!obj->Has(env.local(), v8_str("w")).FromJust());
+  }
+}
+
+
 TEST(DefineOwnProperty) {
   LocalContext env;
   v8::Isolate* isolate = env->GetIsolate();
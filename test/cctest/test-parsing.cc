@@ -381,6 +381,59 @@ TEST(PreparseFunctionDataIsUsed) {
 }
 
 
+TEST(PreParsedScopeDataIsCached) {
+  // Producing cached parser data while parsing eagerly is not supported.
+  if (!i::FLAG_lazy || !i::FLAG_preparser_scope_analysis) return;
+
+  // This tests that the parser cache carries the preparsed scope data of lazy
+  // top-level functions, so that consuming the cache in a fresh process
+  // attaches skip-data to their SharedFunctionInfos.
+
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope handles(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+  CcTest::i_isolate()->stack_guard()->SetStackLimit(
+      i::GetCurrentStackPosition() - 128 * 1024);
+
+  const char* code =
+      "function lazy() { var a = 1; function skip_me() { return a; } "
+      "return skip_me; } lazy;";
+  // The sources differ only in a trailing comment, so that the second
+  // compilation is not a compilation cache hit while all function positions
+  // still match the cached data.
+  std::string produce_code = std::string(code) + "// produce";
+  std::string consume_code = std::string(code) + "// consume";
+
+  v8::ScriptCompiler::Source produce_source(v8_str(produce_code.c_str()));
+  v8::ScriptCompiler::Compile(context, &produce_source,
+                              v8::ScriptCompiler::kProduceParserCache)
+      .ToLocalChecked();
+
+  const v8::ScriptCompiler::CachedData* cached_data =
+      produce_source.GetCachedData();
+  CHECK_NOT_NULL(cached_data->data);
+  CHECK_GT(cached_data->length, 0);
+
+  v8::ScriptCompiler::Source consume_source(
+      v8_str(consume_code.c_str()),
+      new v8::ScriptCompiler::CachedData(cached_data->data,
+                                         cached_data->length));
+  v8::Local<v8::Value> result = CompileRun(
+      context, &consume_source, v8::ScriptCompiler::kConsumeParserCache);
+  CHECK(result->IsFunction());
+
+  // The lazy function was skipped based on the cache; its preparsed scope
+  // data should have come along and be attached to the SharedFunctionInfo.
+  i::Handle<i::JSFunction> lazy = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*v8::Local<v8::Function>::Cast(result)));
+  CHECK(lazy->shared()->HasPreParsedScopeData());
+
+  // The function must still compile and run correctly.
+  v8::Local<v8::Value> inner_result = CompileRun("lazy()()");
+  CHECK_EQ(1, inner_result->Int32Value(context).FromJust());
+}
+
 TEST(StandAlonePreParser) {
   v8::V8::Initialize();
 
@@ -671,6 +724,23 @@ TEST(StreamScanner) {
   }
 }
 
+TEST(CharacterStreamAdvanceUntil) {
+  v8::V8::Initialize();
+  const char* str = "aaa\nbb\rcc";
+  auto is_line_terminator = [](i::uc32 c0) { return c0 == '\n' || c0 == '\r'; };
+
+  std::unique_ptr<i::Utf16CharacterStream> stream(
+      i::ScannerStream::ForTesting(str));
+  CHECK_EQ('\n', stream->AdvanceUntil(is_line_terminator));
+  CHECK_EQ(4u, stream->pos());
+  CHECK_EQ('\r', stream->AdvanceUntil(is_line_terminator));
+  CHECK_EQ(7u, stream->pos());
+  // At the end of the input, AdvanceUntil behaves like Advance(): it returns
+  // kEndOfInput and still advances past the final position.
+  CHECK_EQ(-1, stream->AdvanceUntil(is_line_terminator));
+  CHECK_EQ(10u, stream->pos());
+}
+
 void TestScanRegExp(const char* re_source, const char* expected) {
   auto stream = i::ScannerStream::ForTesting(re_source);
   i::HandleScope scope(CcTest::i_isolate());
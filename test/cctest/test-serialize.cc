@@ -33,6 +33,7 @@
 
 #include "src/api.h"
 #include "src/assembler-inl.h"
+#include "src/base/utils/random-number-generator.h"
 #include "src/bootstrapper.h"
 #include "src/compilation-cache.h"
 #include "src/compiler.h"
@@ -47,6 +48,7 @@
 #include "src/snapshot/natives.h"
 #include "src/snapshot/partial-deserializer.h"
 #include "src/snapshot/partial-serializer.h"
+#include "src/snapshot/snapshot-compression.h"
 #include "src/snapshot/snapshot.h"
 #include "src/snapshot/startup-deserializer.h"
 #include "src/snapshot/startup-serializer.h"
@@ -198,6 +200,28 @@ static void SanityCheck(v8::Isolate* v8_isolate) {
   isolate->factory()->InternalizeOneByteString(STATIC_CHAR_VECTOR("Empty"));
 }
 
+TEST(SnapshotCompressionRoundTrip) {
+  // Several chunks worth of data with long zero runs and incompressible
+  // stretches, mimicking a snapshot payload.
+  const uint32_t kSize = 3 * SnapshotCompression::kChunkSize + 12345;
+  std::vector<byte> payload(kSize);
+  v8::base::RandomNumberGenerator rng(42);
+  for (uint32_t i = 0; i < kSize; i++) {
+    payload[i] = (i / 512) % 3 == 0 ? 0 : static_cast<byte>(rng.NextInt(256));
+  }
+
+  std::vector<byte> compressed = SnapshotCompression::Compress(
+      Vector<const byte>(payload.data(), static_cast<int>(payload.size())));
+  CHECK_EQ(kSize, SnapshotCompression::GetUncompressedSize(Vector<const byte>(
+                      compressed.data(), static_cast<int>(compressed.size()))));
+
+  std::vector<byte> uncompressed;
+  SnapshotCompression::Decompress(
+      Vector<const byte>(compressed.data(), static_cast<int>(compressed.size())),
+      &uncompressed);
+  CHECK(payload == uncompressed);
+}
+
 UNINITIALIZED_TEST(StartupSerializerOnce) {
   DisableLazyDeserialization();
   DisableAlwaysOpt();
@@ -1290,6 +1314,51 @@ TEST(CodeSerializerPromotedToCompilationCache) {
   delete cache;
 }
 
+TEST(CodeSerializerCompileAheadIds) {
+  FLAG_compile_ahead = true;
+  FLAG_compile_ahead_profile_window = 1000000;
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->compilation_cache()->Disable();  // Disable same-isolate code cache.
+
+  v8::HandleScope scope(CcTest::isolate());
+
+  const char* source = "function f() { return 'abc'; } f();";
+
+  Handle<String> src = isolate->factory()
+                           ->NewStringFromUtf8(CStrVector(source))
+                           .ToHandleChecked();
+  ScriptData* unused_cache = nullptr;
+  Handle<SharedFunctionInfo> orig =
+      CompileScript(isolate, src, Handle<String>(), &unused_cache,
+                    v8::ScriptCompiler::kNoCompileOptions);
+
+  // Running the script compiles f lazily, which records it in the isolate's
+  // lazy compilation profile.
+  Handle<JSFunction> fun =
+      isolate->factory()->NewFunctionFromSharedFunctionInfo(
+          orig, isolate->native_context());
+  Handle<JSObject> global(isolate->context()->global_object());
+  Execution::Call(isolate, fun, global, 0, nullptr).ToHandleChecked();
+
+  // A cache produced now must list f as a compile-ahead candidate.
+  ScriptData* cache = CodeSerializer::Serialize(isolate, orig, src);
+
+  SerializedCodeData::SanityCheckResult sanity_check_result =
+      SerializedCodeData::CHECK_SUCCESS;
+  const SerializedCodeData scd = SerializedCodeData::FromCachedData(
+      isolate, cache, SerializedCodeData::SourceHash(src),
+      &sanity_check_result);
+  CHECK_EQ(SerializedCodeData::CHECK_SUCCESS, sanity_check_result);
+
+  Vector<const uint32_t> ids = scd.CompileAheadIds();
+  CHECK_EQ(1, ids.length());
+  // f is the first function literal in the script, after the top-level one.
+  CHECK_EQ(1, ids[0]);
+
+  delete cache;
+}
+
 TEST(CodeSerializerInternalizedString) {
   LocalContext context;
   Isolate* isolate = CcTest::i_isolate();
@@ -1908,6 +1977,94 @@ TEST(CodeSerializerIsolates) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerIncrementalProduction) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = ProduceCache(source);
+
+  // Remember the base cache contents; the source takes ownership of the base
+  // cache itself and replaces it with the newly produced cache.
+  int base_length = cache->length;
+  uint8_t* base_copy = NewArray<uint8_t>(base_length);
+  MemCopy(base_copy, cache->data, base_length);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kProduceCodeCache)
+            .ToLocalChecked();
+
+    // Since the source and compilation state are unchanged, producing against
+    // the base cache must reproduce it byte for byte.
+    const v8::ScriptCompiler::CachedData* data = source.GetCachedData();
+    CHECK(data);
+    CHECK_EQ(base_length, data->length);
+    CHECK_EQ(0, memcmp(base_copy, data->data, base_length));
+
+    v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                      ->Run(isolate2->GetCurrentContext())
+                                      .ToLocalChecked();
+    CHECK(result->ToString(isolate2->GetCurrentContext())
+              .ToLocalChecked()
+              ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+  }
+  DeleteArray(base_copy);
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerBackgroundConsumption) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = ProduceCache(source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    // Perform the heap-independent part of the cache consumption as it would
+    // happen on a background thread.
+    std::unique_ptr<v8::ScriptCompiler::CodeCacheConsumptionTask> task(
+        v8::ScriptCompiler::StartConsumingCodeCache(isolate2, cache));
+    task->Run();
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache, task.get());
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache->rejected);
+    CheckDeserializedFlag(script);
+    v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                      ->Run(isolate2->GetCurrentContext())
+                                      .ToLocalChecked();
+    CHECK(result->ToString(isolate2->GetCurrentContext())
+              .ToLocalChecked()
+              ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerIsolatesEager) {
   const char* source =
       "function f() {"
@@ -2794,5 +2951,33 @@ TEST(BuiltinsHaveBuiltinIdForLazyDeserialization) {
              ->HasLazyDeserializationBuiltinId());
 }
 
+TEST(BytecodeHandlersAreDeserializedOnFirstUse) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  if (!isolate->snapshot_available()) return;
+  i::HandleScope scope(isolate);
+
+  interpreter::Interpreter* interpreter = isolate->interpreter();
+
+  // The requested handler must be real (i.e. not the DeserializeLazy handler)
+  // and installed in the dispatch table afterwards.
+  Code* code = interpreter->GetAndMaybeDeserializeBytecodeHandler(
+      interpreter::Bytecode::kLdaZero, interpreter::OperandScale::kSingle);
+  CHECK_EQ(Code::BYTECODE_HANDLER, code->kind());
+  CHECK(!isolate->heap()->IsDeserializeLazyHandler(code));
+  CHECK_EQ(code,
+           interpreter->GetBytecodeHandler(interpreter::Bytecode::kLdaZero,
+                                           interpreter::OperandScale::kSingle));
+
+  // Handlers that reuse another bytecode's handler resolve to the handler of
+  // the reused bytecode.
+  CHECK_EQ(interpreter->GetAndMaybeDeserializeBytecodeHandler(
+               interpreter::Bytecode::kLdaImmutableContextSlot,
+               interpreter::OperandScale::kSingle),
+           interpreter->GetAndMaybeDeserializeBytecodeHandler(
+               interpreter::Bytecode::kLdaContextSlot,
+               interpreter::OperandScale::kSingle));
+}
+
 }  // namespace internal
 }  // namespace v8
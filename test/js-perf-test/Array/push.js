@@ -0,0 +1,56 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function benchy(name, test, testSetup) {
+  new BenchmarkSuite(name, [1000],
+      [
+        new Benchmark(name, false, false, 0, test, testSetup, ()=>{})
+      ]);
+}
+
+benchy('SmiPush', SmiPush, SmiPushSetup);
+benchy('DoublePush', DoublePush, DoublePushSetup);
+benchy('FastPush', FastPush, FastPushSetup);
+
+var array;
+var result;
+var array_size = 100;
+
+// Although these functions have the same code, they are separated for
+// clean IC feedback.
+function SmiPush() {
+  array.length = 0;
+  for (var i = 0; i < array_size; i++) {
+    result = array.push(i);
+  }
+}
+
+function DoublePush() {
+  array.length = 0;
+  for (var i = 0; i < array_size; i++) {
+    result = array.push(i + 0.5);
+  }
+}
+
+function FastPush() {
+  array.length = 0;
+  for (var i = 0; i < array_size; i++) {
+    result = array.push('a');
+  }
+}
+
+function SmiPushSetup() {
+  array = [1];
+  array.length = 0;
+}
+
+function DoublePushSetup() {
+  array = [0.5];
+  array.length = 0;
+}
+
+function FastPushSetup() {
+  array = ['a'];
+  array.length = 0;
+}
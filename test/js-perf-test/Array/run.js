@@ -13,6 +13,7 @@ load('some.js');
 load('reduce.js');
 load('reduce-right.js');
 load('to-string.js');
+load('push.js');
 
 var success = true;
 
@@ -0,0 +1,85 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function addBenchmark(name, test) {
+  new BenchmarkSuite(name, [1000],
+      [
+        new Benchmark(name, false, false, 0, test)
+      ]);
+}
+
+addBenchmark('Monomorphic-LoadProperty', MonomorphicLoad);
+addBenchmark('Polymorphic-LoadProperty', PolymorphicLoad);
+addBenchmark('Megamorphic-LoadProperty', MegamorphicLoad);
+addBenchmark('Monomorphic-StoreProperty', MonomorphicStore);
+addBenchmark('Megamorphic-StoreProperty', MegamorphicStore);
+
+// Create {count} objects which all have an own property 'x' but pairwise
+// distinct maps, so that an access site seeing {count} of them reaches the
+// corresponding IC state.
+function createObjectsWithDistinctMaps(count) {
+  var objects = [];
+  for (var i = 0; i < count; ++i) {
+    var o = { x: 42 };
+    o['distinct' + i] = i;
+    objects.push(o);
+  }
+  return objects;
+}
+
+function createObjectsWithSameMap(count) {
+  var objects = [];
+  for (var i = 0; i < count; ++i) {
+    objects.push({ x: 42 });
+  }
+  return objects;
+}
+
+var mono_objects = createObjectsWithSameMap(16);
+var poly_objects = createObjectsWithDistinctMaps(4);
+var mega_objects = createObjectsWithDistinctMaps(16);
+
+var result;
+
+// Although the loop bodies are identical, the benchmarks are separate
+// functions so that each access site has clean IC feedback.
+function MonomorphicLoad() {
+  for (var i = 0; i < 1000; ++i) {
+    var o = mono_objects[i & 15];
+    result = o.x; result = o.x; result = o.x; result = o.x; result = o.x;
+    result = o.x; result = o.x; result = o.x; result = o.x; result = o.x;
+  }
+}
+
+function PolymorphicLoad() {
+  for (var i = 0; i < 1000; ++i) {
+    var o = poly_objects[i & 3];
+    result = o.x; result = o.x; result = o.x; result = o.x; result = o.x;
+    result = o.x; result = o.x; result = o.x; result = o.x; result = o.x;
+  }
+}
+
+function MegamorphicLoad() {
+  for (var i = 0; i < 1000; ++i) {
+    var o = mega_objects[i & 15];
+    result = o.x; result = o.x; result = o.x; result = o.x; result = o.x;
+    result = o.x; result = o.x; result = o.x; result = o.x; result = o.x;
+  }
+}
+
+function MonomorphicStore() {
+  for (var i = 0; i < 1000; ++i) {
+    var o = mono_objects[i & 15];
+    o.x = i; o.x = i; o.x = i; o.x = i; o.x = i;
+    o.x = i; o.x = i; o.x = i; o.x = i; o.x = i;
+  }
+}
+
+function MegamorphicStore() {
+  for (var i = 0; i < 1000; ++i) {
+    var o = mega_objects[i & 15];
+    o.x = i; o.x = i; o.x = i; o.x = i; o.x = i;
+    o.x = i; o.x = i; o.x = i; o.x = i; o.x = i;
+  }
+}
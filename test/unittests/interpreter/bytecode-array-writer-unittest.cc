@@ -364,6 +364,111 @@ TEST_F(BytecodeArrayWriterUnittest, DeadcodeElimination) {
   CHECK(source_iterator.done());
 }
 
+TEST_F(BytecodeArrayWriterUnittest, FuseLdaStar) {
+  bool saved_flag = FLAG_ignition_fuse_bytecodes;
+  FLAG_ignition_fuse_bytecodes = true;
+
+  Write(Bytecode::kStackCheck, {10, false});
+  // Simple constant loads followed by Star are fused.
+  Write(Bytecode::kLdaSmi, 127, {55, true});
+  Write(Bytecode::kStar, R(1));
+  Write(Bytecode::kLdaUndefined);
+  Write(Bytecode::kStar, R(2));
+  // A label bound between the load and the Star blocks fusion, since jumps
+  // may target the Star.
+  Write(Bytecode::kLdaZero);
+  BytecodeLabel label;
+  writer()->BindLabel(&label);
+  Write(Bytecode::kStar, R(3));
+  // A Star needing wide operands is not fused.
+  Write(Bytecode::kLdaSmi, 1);
+  Write(Bytecode::kStar, R(200));
+  // A Star source position is transferred to the fused bytecode.
+  Write(Bytecode::kLdaZero);
+  Write(Bytecode::kStar, R(4), {60, true});
+  // No fusion when both bytecodes carry a source position.
+  Write(Bytecode::kLdaZero, {65, true});
+  Write(Bytecode::kStar, R(5), {66, true});
+  Write(Bytecode::kReturn, {70, true});
+
+  static const uint8_t expected_bytes[] = {
+      // clang-format off
+      /*  0 10 E> */ B(StackCheck),
+      /*  1 55 S> */ B(LdaSmiStar), U8(127), R8(1),
+      /*  4       */ B(LdaUndefinedStar), R8(2),
+      /*  6       */ B(LdaZero),
+      /*  7       */ B(Star), R8(3),
+      /*  9       */ B(LdaSmi), U8(1),
+      /* 11       */ B(Wide), B(Star), R16(200),
+      /* 15 60 S> */ B(LdaZeroStar), R8(4),
+      /* 17 65 S> */ B(LdaZero),
+      /* 18 66 S> */ B(Star), R8(5),
+      /* 20 70 S> */ B(Return),
+      // clang-format on
+  };
+  CHECK_EQ(bytecodes()->size(), arraysize(expected_bytes));
+  for (size_t i = 0; i < arraysize(expected_bytes); ++i) {
+    CHECK_EQ(bytecodes()->at(i), expected_bytes[i]);
+  }
+
+  PositionTableEntry expected_positions[] = {{0, 10, false},
+                                             {1, 55, true},
+                                             {15, 60, true},
+                                             {17, 65, true},
+                                             {18, 66, true},
+                                             {20, 70, true}};
+  Handle<BytecodeArray> bytecode_array = writer()->ToBytecodeArray(
+      isolate(), 0, 0, factory()->empty_fixed_array());
+  SourcePositionTableIterator source_iterator(
+      bytecode_array->SourcePositionTable());
+  for (size_t i = 0; i < arraysize(expected_positions); ++i) {
+    const PositionTableEntry& expected = expected_positions[i];
+    CHECK_EQ(source_iterator.code_offset(), expected.code_offset);
+    CHECK_EQ(source_iterator.source_position().ScriptOffset(),
+             expected.source_position);
+    CHECK_EQ(source_iterator.is_statement(), expected.is_statement);
+    source_iterator.Advance();
+  }
+  CHECK(source_iterator.done());
+
+  FLAG_ignition_fuse_bytecodes = saved_flag;
+}
+
+TEST_F(BytecodeArrayWriterUnittest, FuseLdarBinaryOp) {
+  bool saved_flag = FLAG_ignition_fuse_bytecodes;
+  FLAG_ignition_fuse_bytecodes = true;
+
+  Write(Bytecode::kStackCheck, {10, false});
+  // Ldar followed by Add is fused; the Add's expression position moves to
+  // the fused bytecode.
+  Write(Bytecode::kLdar, R(0));
+  Write(Bytecode::kAdd, R(1), 2, {55, false});
+  // Same for Sub.
+  Write(Bytecode::kLdar, R(0));
+  Write(Bytecode::kSub, R(1), 3, {58, false});
+  // No fusion when the Ldar carries a source position of its own.
+  Write(Bytecode::kLdar, R(0), {60, true});
+  Write(Bytecode::kAdd, R(1), 2, {62, false});
+  Write(Bytecode::kReturn, {70, true});
+
+  static const uint8_t expected_bytes[] = {
+      // clang-format off
+      /*  0 10 E> */ B(StackCheck),
+      /*  1 55 E> */ B(LdarAdd), R8(0), R8(1), U8(2),
+      /*  5 58 E> */ B(LdarSub), R8(0), R8(1), U8(3),
+      /*  9 60 S> */ B(Ldar), R8(0),
+      /* 11 62 E> */ B(Add), R8(1), U8(2),
+      /* 14 70 S> */ B(Return),
+      // clang-format on
+  };
+  CHECK_EQ(bytecodes()->size(), arraysize(expected_bytes));
+  for (size_t i = 0; i < arraysize(expected_bytes); ++i) {
+    CHECK_EQ(bytecodes()->at(i), expected_bytes[i]);
+  }
+
+  FLAG_ignition_fuse_bytecodes = saved_flag;
+}
+
 #undef R
 
 }  // namespace bytecode_array_writer_unittest
@@ -64,6 +64,20 @@ TEST_F(ConstantArrayBuilderTest, ToFixedArray) {
   }
 }
 
+TEST_F(ConstantArrayBuilderTest, ToFixedArraySharesHeapNumbers) {
+  CanonicalHandleScope canonical(isolate());
+  ConstantArrayBuilder builder_a(zone());
+  ConstantArrayBuilder builder_b(zone());
+  builder_a.Insert(6.5);
+  builder_b.Insert(6.5);
+  Handle<FixedArray> constant_array_a = builder_a.ToFixedArray(isolate());
+  Handle<FixedArray> constant_array_b = builder_b.ToFixedArray(isolate());
+  // Equal double constants in different constant pools should reference the
+  // same canonical heap number.
+  CHECK_EQ(constant_array_a->get(0), constant_array_b->get(0));
+  CHECK_EQ(HeapNumber::cast(constant_array_a->get(0))->value(), 6.5);
+}
+
 TEST_F(ConstantArrayBuilderTest, ToLargeFixedArray) {
   CanonicalHandleScope canonical(isolate());
   ConstantArrayBuilder builder(zone());
@@ -28,5 +28,22 @@ TEST(Zone, SegmentPoolConstraints) {
   }
 }
 
+TEST(Zone, SegmentPoolThreadCacheReuse) {
+  AccountingAllocator allocator;
+  Segment* segment = allocator.GetSegment(16 * KB);
+  ASSERT_NE(nullptr, segment);
+  size_t size = segment->size();
+
+  // The returned segment lands in this thread's cache line and must be
+  // handed back on the next request of the same size class.
+  allocator.ReturnSegment(segment);
+  EXPECT_EQ(size, allocator.GetCurrentPoolSize());
+  Segment* reused = allocator.GetSegment(16 * KB);
+  EXPECT_EQ(segment, reused);
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+
+  allocator.ReturnSegment(reused);
+}
+
 }  // namespace internal
 }  // namespace v8